@@ -0,0 +1,46 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+
+/**
+ * bench.h -- Utilitas bersama untuk benchmark iot_bench
+ *
+ * Setiap skenario adalah satu fungsi bench_<nama>() di bench/bench_<nama>.cpp
+ * yang mencetak hasilnya sendiri ke stdout (satu baris per konfigurasi).
+ * Daftar skenario ada di bench/iot_bench.cpp.
+ *
+ * Angka hanya bermakna jika di-build Release (cmake --preset conan-release)
+ * dan dijalankan di mesin yang tidak sedang sibuk.
+ */
+namespace bench {
+    using Clock = std::chrono::steady_clock;
+
+    /// Detik (pecahan) antara dua titik waktu
+    inline double seconds_between(Clock::time_point start, Clock::time_point end) {
+        return std::chrono::duration<double>(end - start).count();
+    }
+
+    /// Nanodetik per operasi
+    inline double ns_per_op(Clock::time_point start, Clock::time_point end, uint64_t ops) {
+        return ops > 0 ? seconds_between(start, end) * 1e9 / static_cast<double>(ops) : 0.0;
+    }
+
+    /**
+     * Cegah compiler membuang hasil perhitungan benchmark.
+     */
+    template <typename T>
+    inline void do_not_optimize(const T& value) {
+        asm volatile("" : : "r,m"(value) : "memory");
+    }
+
+    /// Judul skenario
+    inline void print_header(const char* title) {
+        std::printf("\n== %s ==\n", title);
+    }
+}
+
+// Skenario (lihat bench/iot_bench.cpp)
+void bench_observer();
+void bench_dds();
+void bench_json();
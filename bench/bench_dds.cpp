@@ -0,0 +1,90 @@
+/**
+ * bench_dds.cpp -- Throughput DdsPublisher per ukuran batch
+ *
+ * Mengukur data/detik yang bisa ditulis DdsPublisher:
+ *   - batch "off" : satu sample Messengger::Message per data (instance keyed)
+ *   - batch N     : Messengger::MessageBatch berisi N data per sample
+ *
+ * Setiap konfigurasi memakai DdsPublisher baru (participant baru) yang
+ * diinisialisasi lewat DDS_BATCH_* seperti di produksi; latency budget
+ * dibuat besar agar batch hanya di-flush karena penuh.
+ *
+ * Konfigurasi RTPS dari DDS_CONFIG_FILE (default: rtps.ini di folder kerja).
+ * Tanpa subscriber yang match, OpenDDS hanya men-serialisasi dan menyimpan
+ * sample; jalankan subscriber di domain yang sama untuk mengukur jalur wire.
+ */
+#include "bench.h"
+#include "dds/dds_publisher.h"
+#include <spdlog/spdlog.h>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace {
+constexpr uint64_t kReadings = 200000;
+constexpr int kSensors = 64;
+constexpr size_t kBatchSizes[] = {0, 1, 8, 64, 256, 1024};  // 0 = mode batch nonaktif
+
+/**
+ * Publish kReadings data dengan satu DdsPublisher baru.
+ * @return data/detik, atau negatif jika DDS gagal diinisialisasi
+ */
+double run_publisher(size_t batch_size, const std::string& config_path) {
+    if (batch_size == 0) {
+        unsetenv("DDS_BATCH_MODE");
+    } else {
+        setenv("DDS_BATCH_MODE", "on", 1);
+        setenv("DDS_BATCH_MAX", std::to_string(batch_size).c_str(), 1);
+        setenv("DDS_BATCH_LATENCY_US", "1000000", 1);
+    }
+
+    std::vector<std::string> arg_strings = {"iot_bench", "-DCPSConfigFile", config_path};
+    std::vector<char*> argv;
+    for (auto& arg : arg_strings) {
+        argv.push_back(&arg[0]);
+    }
+    argv.push_back(nullptr);
+
+    DdsPublisher publisher;
+    if (!publisher.init(static_cast<int>(arg_strings.size()), argv.data())) {
+        return -1.0;
+    }
+
+    Messengger::Message msg;
+    msg.sensor_name = "BenchSensor";
+    msg.location = "Lab";
+    msg.temperature = 25.0;
+    msg.humidity = 60.0;
+    msg.pressure = 1013.25;
+    msg.light_intensity = 300.0;
+
+    auto start = bench::Clock::now();
+    for (uint64_t i = 0; i < kReadings; ++i) {
+        msg.sensor_id = static_cast<CORBA::Long>(i % kSensors);
+        msg.timestamp = static_cast<CORBA::LongLong>(i);
+        publisher.publish(msg);
+    }
+    publisher.flush();
+    return static_cast<double>(kReadings) / bench::seconds_between(start, bench::Clock::now());
+}
+}  // namespace
+
+void bench_dds() {
+    bench::print_header("dds: DdsPublisher readings/sec per batch size");
+    const char* config_env = std::getenv("DDS_CONFIG_FILE");
+    std::string config_path = (config_env && *config_env) ? config_env : "rtps.ini";
+    std::printf("config: %s, readings: %llu, sensors: %d\n", config_path.c_str(),
+                static_cast<unsigned long long>(kReadings), kSensors);
+    std::printf("%10s %16s %12s\n", "batch", "readings/s", "ns/reading");
+
+    spdlog::set_level(spdlog::level::warn);
+    for (size_t batch_size : kBatchSizes) {
+        double rate = run_publisher(batch_size, config_path);
+        std::string label = batch_size == 0 ? "off" : std::to_string(batch_size);
+        if (rate < 0) {
+            std::printf("%10s %16s\n", label.c_str(), "init failed");
+            continue;
+        }
+        std::printf("%10s %16.0f %12.1f\n", label.c_str(), rate, 1e9 / rate);
+    }
+}
@@ -0,0 +1,102 @@
+/**
+ * bench_json.cpp -- Serialisasi JSON satu data sensor
+ *
+ * Membandingkan ns/data untuk:
+ *   - dom    : jalur lama -- rapidjson::Document per data, location disalin
+ *              ke allocator DOM, StringBuffer baru, lalu disalin ke std::string
+ *   - stream : utils::sensor_to_json() -- JsonEncoder thread-local, hasil
+ *              disalin sekali ke std::string (yang dipakai WebSocketAdapter)
+ *   - view   : utils::sensor_to_json_view() -- tanpa alokasi sama sekali
+ *
+ * Jalur dom menulis field yang sama dengan urutan yang sama
+ * (IOT_SENSOR_REQUEST_FIELDS); output ketiganya dicek identik sebelum diukur.
+ */
+#include "bench.h"
+#include "utils/json_helper.h"
+#include <rapidjson/document.h>
+#include <array>
+#include <string>
+
+namespace {
+constexpr uint64_t kIterations = 2000000;
+constexpr size_t kSamples = 64;  // Data berbeda yang diputar (nilai double beragam)
+
+/// Jalur lama: bangun DOM lalu serialisasi
+std::string sensor_to_json_dom(const SensorSample& sample) {
+    rapidjson::Document doc;
+    doc.SetObject();
+    rapidjson::Document::AllocatorType& allocator = doc.GetAllocator();
+#define IOT_DOM_SCALAR(type, name, tag) \
+    doc.AddMember(#name, sample.name, allocator);
+#define IOT_DOM_STRING(name, tag)                                                              \
+    doc.AddMember(#name,                                                                       \
+                  rapidjson::Value(sample.name().c_str(),                                      \
+                                   static_cast<rapidjson::SizeType>(sample.name().size()),     \
+                                   allocator).Move(),                                          \
+                  allocator);
+    IOT_SENSOR_REQUEST_FIELDS(IOT_DOM_SCALAR, IOT_DOM_STRING)
+#undef IOT_DOM_SCALAR
+#undef IOT_DOM_STRING
+
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    doc.Accept(writer);
+    return buffer.GetString();
+}
+
+std::array<SensorSample, kSamples> make_samples() {
+    auto& interner = utils::StringInterner::global();
+    std::array<SensorSample, kSamples> samples{};
+    for (size_t i = 0; i < kSamples; ++i) {
+        SensorSample& sample = samples[i];
+        sample.sensor_id = static_cast<int32_t>(i);
+        sample.sensor_name_id = interner.intern("DHT22");
+        sample.location_id = interner.intern(i % 2 ? "Room A" : "Warehouse North");
+        sample.temperature = 20.0 + static_cast<double>(i) * 0.137;
+        sample.humidity = 40.0 + static_cast<double>(i) * 0.71;
+        sample.pressure = 1013.25 - static_cast<double>(i) * 0.05;
+        sample.light_intensity = 300.0 + static_cast<double>(i) / 3.0;
+        sample.timestamp = 1700000000000 + static_cast<int64_t>(i);
+    }
+    return samples;
+}
+
+/**
+ * Jalankan encode kIterations kali.
+ * @return ns per data
+ */
+template <typename Encode>
+double run(const std::array<SensorSample, kSamples>& samples, Encode encode) {
+    size_t bytes = 0;
+    auto start = bench::Clock::now();
+    for (uint64_t i = 0; i < kIterations; ++i) {
+        bytes += encode(samples[i % kSamples]);
+    }
+    auto end = bench::Clock::now();
+    bench::do_not_optimize(bytes);
+    return bench::ns_per_op(start, end, kIterations);
+}
+}  // namespace
+
+void bench_json() {
+    bench::print_header("json: sensor_to_json() streaming encoder vs DOM");
+    auto samples = make_samples();
+
+    for (const auto& sample : samples) {
+        if (sensor_to_json_dom(sample) != utils::sensor_to_json(sample)) {
+            std::printf("output mismatch for sensor_id=%d\n", sample.sensor_id);
+            return;
+        }
+    }
+    std::printf("iterations: %llu, example: %s\n", static_cast<unsigned long long>(kIterations),
+                utils::sensor_to_json(samples[1]).c_str());
+
+    double dom = run(samples, [](const SensorSample& s) { return sensor_to_json_dom(s).size(); });
+    double stream = run(samples, [](const SensorSample& s) { return utils::sensor_to_json(s).size(); });
+    double view = run(samples, [](const SensorSample& s) { return utils::sensor_to_json_view(s).size(); });
+
+    std::printf("%8s %12s %10s\n", "path", "ns/reading", "vs dom");
+    std::printf("%8s %12.1f %9.2fx\n", "dom", dom, 1.0);
+    std::printf("%8s %12.1f %9.2fx\n", "stream", stream, dom / stream);
+    std::printf("%8s %12.1f %9.2fx\n", "view", view, dom / view);
+}
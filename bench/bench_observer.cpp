@@ -0,0 +1,129 @@
+/**
+ * bench_observer.cpp -- Contention Observable::notify_observers()
+ *
+ * Membandingkan Observable (snapshot copy-on-write, reader tanpa lock)
+ * dengan implementasi lama yang memegang satu mutex selama memanggil semua
+ * observer. Setiap thread mensimulasikan satu stream gRPC yang memanggil
+ * notify_observers() terus-menerus dengan 2 observer ringan (seperti
+ * SensorDataLogHandler + SensorDataValidator).
+ *
+ * Output per jumlah stream: total notify/detik dan ns per notify.
+ */
+#include "bench.h"
+#include "adapters/abstract_adapters/observable/observable.h"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+constexpr uint64_t kNotifiesPerStream = 500000;
+constexpr size_t kStreamCounts[] = {1, 2, 4, 8, 16};
+
+/// Observer ringan: sedikit kerja per data, tanpa state bersama antar thread
+class SumObserver : public Observer {
+public:
+    void on_sensor_data(const SensorSample& sample) override {
+        thread_local double sum = 0.0;
+        sum += sample.temperature + sample.humidity;
+        bench::do_not_optimize(sum);
+    }
+
+    std::string observer_name() const override {
+        return "SumObserver";
+    }
+};
+
+/// Implementasi lama: mutex dipegang selama semua observer dipanggil
+class MutexObservable : public IObservable {
+public:
+    void add_observer(std::shared_ptr<Observer> observer) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        observers_.push_back(std::move(observer));
+    }
+
+    void remove_observer(std::shared_ptr<Observer> observer) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        observers_.erase(std::remove(observers_.begin(), observers_.end(), observer), observers_.end());
+    }
+
+    void notify_observers(const SensorSample& sample) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& observer : observers_) {
+            observer->on_sensor_data(sample);
+        }
+    }
+
+    void notify_observers_batch(absl::Span<const SensorSample> batch) override {
+        for (const auto& sample : batch) {
+            notify_observers(sample);
+        }
+    }
+
+private:
+    std::mutex mutex_;
+    std::vector<std::shared_ptr<Observer>> observers_;
+};
+
+/**
+ * Jalankan `streams` thread yang masing-masing memanggil notify_observers()
+ * kNotifiesPerStream kali; start bersamaan (spin di atas flag).
+ * @return Waktu total (detik) dari start sampai thread terakhir selesai
+ */
+double run_streams(IObservable& observable, size_t streams) {
+    std::atomic<bool> go{false};
+    std::vector<std::thread> threads;
+    threads.reserve(streams);
+    for (size_t s = 0; s < streams; ++s) {
+        threads.emplace_back([&observable, &go, s] {
+            SensorSample sample;
+            sample.sensor_id = static_cast<int32_t>(s);
+            sample.temperature = 25.0;
+            sample.humidity = 60.0;
+            while (!go.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            for (uint64_t i = 0; i < kNotifiesPerStream; ++i) {
+                observable.notify_observers(sample);
+            }
+        });
+    }
+    auto start = bench::Clock::now();
+    go.store(true, std::memory_order_release);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    return bench::seconds_between(start, bench::Clock::now());
+}
+
+template <typename ObservableType>
+void register_observers(ObservableType& observable) {
+    observable.add_observer(std::make_shared<SumObserver>());
+    observable.add_observer(std::make_shared<SumObserver>());
+}
+}  // namespace
+
+void bench_observer() {
+    bench::print_header("observer: notify_observers() with 2 observers");
+    std::printf("hardware threads: %u, notifies per stream: %llu\n",
+                std::thread::hardware_concurrency(), static_cast<unsigned long long>(kNotifiesPerStream));
+    std::printf("%8s %22s %22s %10s\n", "streams", "cow (Mnotify/s, ns)", "mutex (Mnotify/s, ns)", "speedup");
+
+    spdlog::set_level(spdlog::level::warn);  // Sembunyikan log add_observer()
+    Observable cow;
+    MutexObservable locked;
+    register_observers(cow);
+    register_observers(locked);
+
+    for (size_t streams : kStreamCounts) {
+        double total = static_cast<double>(kNotifiesPerStream * streams);
+        double cow_seconds = run_streams(cow, streams);
+        double mutex_seconds = run_streams(locked, streams);
+        std::printf("%8zu %13.2f %8.1f %13.2f %8.1f %9.2fx\n", streams,
+                    total / cow_seconds / 1e6, cow_seconds * 1e9 / total,
+                    total / mutex_seconds / 1e6, mutex_seconds * 1e9 / total,
+                    mutex_seconds / cow_seconds);
+    }
+}
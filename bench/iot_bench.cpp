@@ -0,0 +1,51 @@
+/**
+ * iot_bench.cpp -- Benchmark hot path iot_bridge
+ *
+ * Cara pakai:
+ *   ./build/iot_bench              # semua skenario
+ *   ./build/iot_bench observer     # skenario tertentu
+ *
+ * Skenario:
+ *   observer : notify_observers() copy-on-write vs mutex, 1..16 stream
+ *   dds      : DdsPublisher data/detik, tanpa batch vs MessageBatch 1..1024
+ *   json     : sensor_to_json() encoder streaming vs DOM, ns/data
+ */
+#include "bench.h"
+#include <cstdio>
+#include <cstring>
+
+namespace {
+struct Scenario {
+    const char* name;
+    void (*run)();
+};
+
+const Scenario kScenarios[] = {
+    {"observer", bench_observer},
+    {"dds", bench_dds},
+    {"json", bench_json},
+};
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        for (const auto& scenario : kScenarios) {
+            scenario.run();
+        }
+        return 0;
+    }
+    for (int i = 1; i < argc; ++i) {
+        bool found = false;
+        for (const auto& scenario : kScenarios) {
+            if (std::strcmp(argv[i], scenario.name) == 0) {
+                scenario.run();
+                found = true;
+            }
+        }
+        if (!found) {
+            std::fprintf(stderr, "iot_bench: unknown scenario '%s'\n", argv[i]);
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,92 @@
+###############################################################################
+# generate_sensor_fields.cmake -- Generate tabel field SensorRequest
+#
+# Membaca message SensorRequest dari sensor.proto dan menulis header
+# sensor_fields.h berisi X-macro IOT_SENSOR_REQUEST_FIELDS(SCALAR, STRING):
+#
+#   SCALAR(int32_t, sensor_id, 1)   -> field numerik (tipe C++, nama, nomor field)
+#   STRING(sensor_name, 2)          -> field string
+#
+# Urutan = urutan deklarasi di .proto. Serializer (utils::write_sensor_json)
+# meng-expand macro ini saat compile, jadi field baru di .proto otomatis
+# ikut diserialisasi tanpa reflection saat runtime.
+#
+# Dijalankan oleh add_custom_command di CMakeLists.txt:
+#   cmake -DPROTO_FILE=proto/sensor.proto -DOUTPUT_FILE=<out>/sensor_fields.h
+#         -P cmake/generate_sensor_fields.cmake
+###############################################################################
+
+if(NOT PROTO_FILE OR NOT OUTPUT_FILE)
+    message(FATAL_ERROR "generate_sensor_fields: PROTO_FILE dan OUTPUT_FILE wajib diisi")
+endif()
+
+file(READ "${PROTO_FILE}" PROTO_CONTENT)
+
+# Buang komentar // dan /* */ agar tidak ikut di-parse
+string(REGEX REPLACE "/\\*([^*]|\\*+[^*/])*\\*+/" "" PROTO_CONTENT "${PROTO_CONTENT}")
+string(REGEX REPLACE "//[^\n]*" "" PROTO_CONTENT "${PROTO_CONTENT}")
+
+# Ambil isi blok message SensorRequest { ... } (tanpa nested message)
+string(REGEX MATCH "message[ \t\r\n]+SensorRequest[ \t\r\n]*{[^}]*}" MESSAGE_BLOCK "${PROTO_CONTENT}")
+if(NOT MESSAGE_BLOCK)
+    message(FATAL_ERROR "generate_sensor_fields: message SensorRequest tidak ditemukan di ${PROTO_FILE}")
+endif()
+
+# Field repeated/map/oneof tidak punya padanan di SensorSample (satu nilai per data)
+if(MESSAGE_BLOCK MATCHES "(^|[ \t\r\n{])(repeated|map[ \t]*<|oneof)")
+    message(FATAL_ERROR "generate_sensor_fields: SensorRequest hanya boleh berisi field scalar/string")
+endif()
+
+# Tipe scalar proto3 -> tipe C++ (sama dengan yang dipakai protoc)
+set(CPP_TYPE_int32    "int32_t")
+set(CPP_TYPE_sint32   "int32_t")
+set(CPP_TYPE_sfixed32 "int32_t")
+set(CPP_TYPE_int64    "int64_t")
+set(CPP_TYPE_sint64   "int64_t")
+set(CPP_TYPE_sfixed64 "int64_t")
+set(CPP_TYPE_uint32   "uint32_t")
+set(CPP_TYPE_fixed32  "uint32_t")
+set(CPP_TYPE_uint64   "uint64_t")
+set(CPP_TYPE_fixed64  "uint64_t")
+set(CPP_TYPE_double   "double")
+set(CPP_TYPE_float    "float")
+set(CPP_TYPE_bool     "bool")
+
+# Deklarasi "<tipe> <nama> = <nomor>" (tanpa ';' -- pemisah list CMake)
+string(REGEX MATCHALL "[A-Za-z_][A-Za-z0-9_.]*[ \t\r\n]+[A-Za-z_][A-Za-z0-9_]*[ \t\r\n]*=[ \t\r\n]*[0-9]+"
+       FIELD_DECLS "${MESSAGE_BLOCK}")
+
+set(FIELD_LINES "")
+foreach(DECL IN LISTS FIELD_DECLS)
+    string(REGEX MATCH "([A-Za-z_][A-Za-z0-9_.]*)[ \t\r\n]+([A-Za-z_][A-Za-z0-9_]*)[ \t\r\n]*=[ \t\r\n]*([0-9]+)" _ "${DECL}")
+    set(FIELD_TYPE "${CMAKE_MATCH_1}")
+    set(FIELD_NAME "${CMAKE_MATCH_2}")
+    set(FIELD_NUMBER "${CMAKE_MATCH_3}")
+
+    if(FIELD_TYPE STREQUAL "string")
+        string(APPEND FIELD_LINES "    STRING(${FIELD_NAME}, ${FIELD_NUMBER}) \\\n")
+    elseif(DEFINED CPP_TYPE_${FIELD_TYPE})
+        string(APPEND FIELD_LINES "    SCALAR(${CPP_TYPE_${FIELD_TYPE}}, ${FIELD_NAME}, ${FIELD_NUMBER}) \\\n")
+    else()
+        message(FATAL_ERROR "generate_sensor_fields: tipe '${FIELD_TYPE}' (field ${FIELD_NAME}) belum didukung")
+    endif()
+endforeach()
+
+if(FIELD_LINES STREQUAL "")
+    message(FATAL_ERROR "generate_sensor_fields: SensorRequest tidak memiliki field")
+endif()
+
+set(HEADER_CONTENT "#pragma once
+// sensor_fields.h -- DI-GENERATE dari sensor.proto (message SensorRequest)
+// oleh cmake/generate_sensor_fields.cmake. JANGAN diedit manual.
+//
+// IOT_SENSOR_REQUEST_FIELDS(SCALAR, STRING):
+//   SCALAR(cpp_type, name, tag)    -- field numerik
+//   STRING(name, tag)              -- field string
+
+#define IOT_SENSOR_REQUEST_FIELDS(SCALAR, STRING) \\
+${FIELD_LINES}
+")
+
+# Tulis hanya jika isinya berubah (hindari rebuild yang tidak perlu)
+file(CONFIGURE OUTPUT "${OUTPUT_FILE}" CONTENT "${HEADER_CONTENT}" @ONLY)
@@ -1,70 +0,0 @@
-// -*- C++ -*-
-/**
- * Code generated by the The ACE ORB (TAO) IDL Compiler v4.0.0
- * TAO and the TAO IDL Compiler have been developed by:
- *       Center for Distributed Object Computing
- *       Washington University
- *       St. Louis, MO
- *       USA
- * and
- *       Distributed Object Computing Laboratory
- *       University of California at Irvine
- *       Irvine, CA
- *       USA
- * and
- *       Institute for Software Integrated Systems
- *       Vanderbilt University
- *       Nashville, TN
- *       USA
- *       https://www.isis.vanderbilt.edu/
- *
- * Information about TAO is available at:
- *     https://www.dre.vanderbilt.edu/~schmidt/TAO.html
- **/
-
-// TAO_IDL - Generated from
-// /opt/odds3291-java/OpenDDS-3.29.1/ACE_wrappers/TAO/TAO_IDL/be/be_codegen.cpp:372
-
-
-#include "SensorDataC.h"
-#include "tao/CDR.h"
-// TAO_IDL - Generated from
-// /opt/odds3291-java/OpenDDS-3.29.1/ACE_wrappers/TAO/TAO_IDL/be/be_visitor_structure/cdr_op_cs.cpp:48
-
-
-TAO_BEGIN_VERSIONED_NAMESPACE_DECL
-
-::CORBA::Boolean operator<< (
-    TAO_OutputCDR &strm,
-    const Messengger::Message &_tao_aggregate)
-{
-  return
-    (strm << _tao_aggregate.sensor_id) &&
-    (strm << _tao_aggregate.sensor_name.in ()) &&
-    (strm << _tao_aggregate.temperature) &&
-    (strm << _tao_aggregate.humidity) &&
-    (strm << _tao_aggregate.pressure) &&
-    (strm << _tao_aggregate.light_intensity) &&
-    (strm << _tao_aggregate.timestamp) &&
-    (strm << _tao_aggregate.location.in ());
-}
-
-::CORBA::Boolean operator>> (
-    TAO_InputCDR &strm,
-    Messengger::Message &_tao_aggregate)
-{
-  return
-    (strm >> _tao_aggregate.sensor_id) &&
-    (strm >> _tao_aggregate.sensor_name.out ()) &&
-    (strm >> _tao_aggregate.temperature) &&
-    (strm >> _tao_aggregate.humidity) &&
-    (strm >> _tao_aggregate.pressure) &&
-    (strm >> _tao_aggregate.light_intensity) &&
-    (strm >> _tao_aggregate.timestamp) &&
-    (strm >> _tao_aggregate.location.out ());
-}
-
-TAO_END_VERSIONED_NAMESPACE_DECL
-
-
-
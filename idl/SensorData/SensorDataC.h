@@ -1,170 +0,0 @@
-// -*- C++ -*-
-/**
- * Code generated by the The ACE ORB (TAO) IDL Compiler v4.0.0
- * TAO and the TAO IDL Compiler have been developed by:
- *       Center for Distributed Object Computing
- *       Washington University
- *       St. Louis, MO
- *       USA
- * and
- *       Distributed Object Computing Laboratory
- *       University of California at Irvine
- *       Irvine, CA
- *       USA
- * and
- *       Institute for Software Integrated Systems
- *       Vanderbilt University
- *       Nashville, TN
- *       USA
- *       https://www.isis.vanderbilt.edu/
- *
- * Information about TAO is available at:
- *     https://www.dre.vanderbilt.edu/~schmidt/TAO.html
- **/
-
-// TAO_IDL - Generated from
-// /opt/odds3291-java/OpenDDS-3.29.1/ACE_wrappers/TAO/TAO_IDL/be/be_codegen.cpp:148
-
-#ifndef _TAO_IDL_SENSORDATAC_AI7J0S_H_
-#define _TAO_IDL_SENSORDATAC_AI7J0S_H_
-
-
-#include /**/ <ace/config-all.h>
-
-#if !defined (ACE_LACKS_PRAGMA_ONCE)
-# pragma once
-#endif /* ACE_LACKS_PRAGMA_ONCE */
-
-
-#include <tao/ORB.h>
-#include <tao/Basic_Types_IDLv4.h>
-TAO_BEGIN_VERSIONED_NAMESPACE_DECL
-
-namespace CORBA
-{
-  using namespace IDLv4;
-}
-
-TAO_END_VERSIONED_NAMESPACE_DECL
-
-#include <tao/String_Manager_T.h>
-#include <tao/VarOut_T.h>
-#include <tao/Arg_Traits_T.h>
-#include <tao/Basic_Arguments.h>
-#include <tao/Special_Basic_Arguments.h>
-#include <tao/Any_Insert_Policy_T.h>
-#include <tao/Fixed_Size_Argument_T.h>
-#include <tao/Var_Size_Argument_T.h>
-#include "tao/UB_String_Arguments.h"
-#include /**/ "tao/Version.h"
-#include /**/ "tao/Versioned_Namespace.h"
-
-#if TAO_MAJOR_VERSION != 4 || TAO_MINOR_VERSION != 0 || TAO_MICRO_VERSION != 0
-#error This file should be regenerated with TAO_IDL
-#endif
-// TAO_IDL - Generated from
-// /opt/odds3291-java/OpenDDS-3.29.1/ACE_wrappers/TAO/TAO_IDL/be/be_visitor_module/module_ch.cpp:34
-
-namespace Messengger
-{
-  // TAO_IDL - Generated from
-  // /opt/odds3291-java/OpenDDS-3.29.1/ACE_wrappers/TAO/TAO_IDL/be/be_type.cpp:258
-
-  
-
-  struct Message;
-  using Message_var = ::TAO_Var_Var_T<Message>;
-  using Message_out = ::TAO_Out_T<Message>;
-
-  
-  // TAO_IDL - Generated from
-  // /opt/odds3291-java/OpenDDS-3.29.1/ACE_wrappers/TAO/TAO_IDL/be/be_visitor_structure/structure_ch.cpp:47
-
-  
-
-  struct  Message
-  {
-    // TAO_IDL - Generated from
-    // /opt/odds3291-java/OpenDDS-3.29.1/ACE_wrappers/TAO/TAO_IDL/be/be_type.cpp:297
-
-    
-    using _var_type = Message_var;
-    using _out_type = Message_out;
-    
-    ::CORBA::Long sensor_id;
-    ::TAO::String_Manager sensor_name;
-    ::CORBA::Double temperature;
-    ::CORBA::Double humidity;
-    ::CORBA::Double pressure;
-    ::CORBA::Double light_intensity;
-    ::CORBA::LongLong timestamp;
-    ::TAO::String_Manager location;
-  };
-
-
-// TAO_IDL - Generated from
-// /opt/odds3291-java/OpenDDS-3.29.1/ACE_wrappers/TAO/TAO_IDL/be/be_visitor_module/module_ch.cpp:62
-
-
-} // module Messengger
-// TAO_IDL - Generated from
-// /opt/odds3291-java/OpenDDS-3.29.1/ACE_wrappers/TAO/TAO_IDL/be/be_visitor_arg_traits.cpp:64
-
-
-
-TAO_BEGIN_VERSIONED_NAMESPACE_DECL
-
-
-// Arg traits specializations.
-namespace TAO
-{
-  // TAO_IDL - Generated from
-  // /opt/odds3291-java/OpenDDS-3.29.1/ACE_wrappers/TAO/TAO_IDL/be/be_visitor_arg_traits.cpp:931
-
-  
-
-  template<>
-  class Arg_Traits< ::Messengger::Message>
-    : public
-        Var_Size_Arg_Traits_T<
-            ::Messengger::Message,
-            TAO::Any_Insert_Policy_Noop
-          >
-  {
-  };
-}
-
-TAO_END_VERSIONED_NAMESPACE_DECL
-
-
-// TAO_IDL - Generated from
-// /opt/odds3291-java/OpenDDS-3.29.1/ACE_wrappers/TAO/TAO_IDL/be/be_visitor_traits.cpp:58
-
-
-
-TAO_BEGIN_VERSIONED_NAMESPACE_DECL
-
-// Traits specializations.
-namespace TAO
-{
-}
-TAO_END_VERSIONED_NAMESPACE_DECL
-
-
-// TAO_IDL - Generated from
-// /opt/odds3291-java/OpenDDS-3.29.1/ACE_wrappers/TAO/TAO_IDL/be/be_visitor_structure/cdr_op_ch.cpp:37
-
-
-TAO_BEGIN_VERSIONED_NAMESPACE_DECL
-
- ::CORBA::Boolean operator<< (TAO_OutputCDR &, const Messengger::Message &);
- ::CORBA::Boolean operator>> (TAO_InputCDR &, Messengger::Message &);
-
-TAO_END_VERSIONED_NAMESPACE_DECL
-
-
-// TAO_IDL - Generated from
-// /opt/odds3291-java/OpenDDS-3.29.1/ACE_wrappers/TAO/TAO_IDL/be/be_codegen.cpp:1648
-
-#endif /* ifndef */
-
@@ -1,35 +0,0 @@
-// -*- C++ -*-
-/**
- * Code generated by the The ACE ORB (TAO) IDL Compiler v4.0.0
- * TAO and the TAO IDL Compiler have been developed by:
- *       Center for Distributed Object Computing
- *       Washington University
- *       St. Louis, MO
- *       USA
- * and
- *       Distributed Object Computing Laboratory
- *       University of California at Irvine
- *       Irvine, CA
- *       USA
- * and
- *       Institute for Software Integrated Systems
- *       Vanderbilt University
- *       Nashville, TN
- *       USA
- *       https://www.isis.vanderbilt.edu/
- *
- * Information about TAO is available at:
- *     https://www.dre.vanderbilt.edu/~schmidt/TAO.html
- **/
-
-// TAO_IDL - Generated from
-// /opt/odds3291-java/OpenDDS-3.29.1/ACE_wrappers/TAO/TAO_IDL/be/be_codegen.cpp:631
-
-#ifndef _TAO_IDL_SENSORDATAS_GWFGSG_CPP_
-#define _TAO_IDL_SENSORDATAS_GWFGSG_CPP_
-
-
-#include "SensorDataS.h"
-
-#endif /* ifndef */
-
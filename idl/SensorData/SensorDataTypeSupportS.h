@@ -1,81 +0,0 @@
-// -*- C++ -*-
-/**
- * Code generated by the The ACE ORB (TAO) IDL Compiler v4.0.0
- * TAO and the TAO IDL Compiler have been developed by:
- *       Center for Distributed Object Computing
- *       Washington University
- *       St. Louis, MO
- *       USA
- * and
- *       Distributed Object Computing Laboratory
- *       University of California at Irvine
- *       Irvine, CA
- *       USA
- * and
- *       Institute for Software Integrated Systems
- *       Vanderbilt University
- *       Nashville, TN
- *       USA
- *       https://www.isis.vanderbilt.edu/
- *
- * Information about TAO is available at:
- *     https://www.dre.vanderbilt.edu/~schmidt/TAO.html
- **/
-
-// TAO_IDL - Generated from
-// /opt/odds3291-java/OpenDDS-3.29.1/ACE_wrappers/TAO/TAO_IDL/be/be_codegen.cpp:454
-
-#ifndef _TAO_IDL_SENSORDATATYPESUPPORTS_OMBAMN_H_
-#define _TAO_IDL_SENSORDATATYPESUPPORTS_OMBAMN_H_
-
-
-#include "SensorDataTypeSupportC.h"
-#include "SensorDataS.h"
-#include "dds/DdsDcpsInfrastructureS.h"
-#include "dds/DdsDcpsPublicationS.h"
-#include "dds/DdsDcpsSubscriptionExtS.h"
-#include "dds/DdsDcpsTopicS.h"
-#include "dds/DdsDcpsTypeSupportExtS.h"
-#include "dds/DdsDynamicDataS.h"
-#include "tao/PortableServer/Basic_SArguments.h"
-#include "tao/PortableServer/Special_Basic_SArguments.h"
-#include "tao/PortableServer/Fixed_Size_SArgument_T.h"
-#include "tao/PortableServer/Var_Size_SArgument_T.h"
-#include "tao/PortableServer/Object_SArg_Traits.h"
-#include "tao/PortableServer/UB_String_SArguments.h"
-
-#if !defined (ACE_LACKS_PRAGMA_ONCE)
-# pragma once
-#endif /* ACE_LACKS_PRAGMA_ONCE */
-
-// TAO_IDL - Generated from
-// /opt/odds3291-java/OpenDDS-3.29.1/ACE_wrappers/TAO/TAO_IDL/be/be_visitor_arg_traits.cpp:64
-
-
-
-TAO_BEGIN_VERSIONED_NAMESPACE_DECL
-
-
-// Arg traits specializations.
-namespace TAO
-{
-}
-
-TAO_END_VERSIONED_NAMESPACE_DECL
-
-
-// TAO_IDL - Generated from
-// /opt/odds3291-java/OpenDDS-3.29.1/ACE_wrappers/TAO/TAO_IDL/be/be_visitor_module/module_sh.cpp:34
-
-namespace POA_Messengger
-{
-  
-
-
-// TAO_IDL - Generated from
-// /opt/odds3291-java/OpenDDS-3.29.1/ACE_wrappers/TAO/TAO_IDL/be/be_visitor_module/module_sh.cpp:65
-
-} // module Messengger
-
-#endif /* ifndef */
-
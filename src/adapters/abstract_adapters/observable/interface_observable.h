@@ -1,5 +1,6 @@
 #pragma once
 #include "handlers/observer/observer.h"
+#include <absl/types/span.h>
 #include <memory>
 
 /**
@@ -10,6 +11,7 @@
  *   - add_observer()    → daftarkan observer baru
  *   - remove_observer() → hapus observer
  *   - notify_observers() → beritahu SEMUA observer yang terdaftar
+ *   - notify_observers_batch() → sama, tapi untuk banyak data sekaligus
  * 
  * Dalam project ini, SensorController implement IObservable.
  * Ketika data gRPC masuk, SensorController memanggil notify_observers()
@@ -33,7 +35,14 @@ public:
 
     /**
      * Notify semua observer yang terdaftar tentang data sensor baru.
-     * @param request Data sensor yang akan dikirim ke semua observers
+     * @param sample Data sensor yang akan dikirim ke semua observers
      */
-    virtual void notify_observers(const iot::SensorRequest& request) = 0;
+    virtual void notify_observers(const SensorSample& sample) = 0;
+
+    /**
+     * Notify semua observer tentang SATU batch data sensor.
+     * Batch diproses sebagai satu unit (satu kali dispatch untuk N data).
+     * @param batch Kumpulan data sensor (misalnya hasil decode SensorBatch)
+     */
+    virtual void notify_observers_batch(absl::Span<const SensorSample> batch) = 0;
 };
\ No newline at end of file
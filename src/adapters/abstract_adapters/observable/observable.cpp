@@ -1,40 +1,70 @@
 #include "observable.h"
 
+const Observable::ObserverList& Observable::snapshot() const {
+    return *observers_.read();
+}
+
 void Observable::add_observer(std::shared_ptr<Observer> observer) {
     if (!observer) {
         spdlog::warn("Observable: Attempted to add null observer");
         return;
     }
 
-    std::lock_guard<std::mutex> lock(observer_mutex_);
-    observers_.push_back(observer);
+    std::lock_guard<std::mutex> lock(writer_mutex_);
+
+    // Copy-on-write: salin snapshot lama, tambahkan, lalu publish
+    auto updated = std::make_shared<ObserverList>(*observers_.load());
+    updated->push_back(observer);
+    observers_.store(std::move(updated));
+
     spdlog::info("Observable: Observer registered - {}", observer->observer_name());
 }
 
 void Observable::remove_observer(std::shared_ptr<Observer> observer) {
-    std::lock_guard<std::mutex> lock(observer_mutex_);
+    std::lock_guard<std::mutex> lock(writer_mutex_);
+
+    auto updated = std::make_shared<ObserverList>(*observers_.load());
 
     // std::remove_if memindahkan elemen yang match ke akhir,
     // lalu erase menghapusnya (Erase-Remove idiom)
-    auto it = std::remove_if(observers_.begin(), observers_.end(),
+    auto it = std::remove_if(updated->begin(), updated->end(),
         [&observer](const std::shared_ptr<Observer>& o) {
             return o == observer;
         });
 
-    if (it != observers_.end()) {
+    if (it != updated->end()) {
         spdlog::info("Observable: Observer removed - {}", observer->observer_name());
-        observers_.erase(it, observers_.end());
+        updated->erase(it, updated->end());
+        observers_.store(std::move(updated));
     }
 }
 
-void Observable::notify_observers(const iot::SensorRequest& request) {
-    std::lock_guard<std::mutex> lock(observer_mutex_);
+void Observable::notify_observers(const SensorSample& sample) {
+    const ObserverList& observers = snapshot();  // Snapshot immutable -- aman diiterasi tanpa lock
+
+    spdlog::debug("Observable: Notifying {} observer(s)", observers.size());
+
+    for (const auto& observer : observers) {
+        if (observer) {
+            observer->on_sensor_data(sample);
+        }
+    }
+}
+
+void Observable::notify_observers_batch(absl::Span<const SensorSample> batch) {
+    if (batch.empty()) {
+        return;
+    }
+
+    const ObserverList& observers = snapshot();
 
-    spdlog::debug("Observable: Notifying {} observer(s)", observers_.size());
+    spdlog::debug("Observable: Notifying {} observer(s) with batch of {}",
+                  observers.size(), batch.size());
 
-    for (auto& observer : observers_) {
+    // Satu virtual call per observer per batch (bukan per data)
+    for (const auto& observer : observers) {
         if (observer) {
-            observer->on_sensor_data(request);
+            observer->on_sensor_batch(batch);
         }
     }
 }
@@ -1,5 +1,6 @@
 #pragma once
 #include "adapters/abstract_adapters/observable/interface_observable.h"
+#include "utils/snapshot_cell.h"
 #include <vector>
 #include <memory>
 #include <algorithm>
@@ -13,9 +14,22 @@
  * Menyimpan daftar observers dan menyediakan method notify_observers()
  * yang memanggil on_sensor_data() pada setiap observer.
  * 
- * Class ini menggunakan mutex untuk thread-safety karena:
- *   - gRPC bisa handle multiple request secara concurrent
- *   - Observer bisa ditambah/dihapus dari thread lain
+ * Thread-safety dengan pola copy-on-write (RCU sederhana):
+ *   - Daftar observer disimpan sebagai snapshot IMMUTABLE
+ *     (shared_ptr<const vector>) di utils::SnapshotCell.
+ *   - notify_observers() membaca snapshot dari cache thread-nya sendiri:
+ *     satu load atomic, tanpa mutex dan tanpa refcount bersama, sehingga
+ *     banyak stream gRPC / dispatcher bisa notify bersamaan tanpa saling tunggu.
+ *     (std::atomic_load pada shared_ptr TIDAK dipakai: di libstdc++ fungsi
+ *     itu mengambil mutex yang sama untuk semua reader.)
+ *   - add_observer()/remove_observer() (jarang) menyalin daftar, mengubah
+ *     salinannya, lalu mem-publish snapshot baru. writer_mutex_ hanya
+ *     mencegah dua writer saling menimpa.
+ *   - Notifikasi yang sedang berjalan tetap memakai snapshot lamanya; snapshot
+ *     lama dibebaskan saat thread terakhir yang menyimpannya membaca versi baru.
+ * 
+ * Konsekuensi: on_sensor_data() pada observer bisa dipanggil dari beberapa
+ * thread SEKALIGUS, jadi observer harus thread-safe sendiri.
  * 
  * Inheritance chain:
  *   IObservable (interface)
@@ -40,14 +54,31 @@ public:
      * Notify SEMUA observer yang terdaftar.
      * Memanggil on_sensor_data() pada setiap observer secara berurutan.
      * 
-     * @param request Data sensor dari gRPC yang akan diberitahukan
+     * @param sample Data sensor dari gRPC yang akan diberitahukan
+     */
+    void notify_observers(const SensorSample& sample) override;
+
+    /**
+     * Notify SEMUA observer tentang satu batch data sensor.
+     * Snapshot observer hanya dibaca SEKALI untuk seluruh batch, dan setiap
+     * observer menerima seluruh batch via on_sensor_batch().
+     * 
+     * @param batch Kumpulan data sensor yang akan diberitahukan
      */
-    void notify_observers(const iot::SensorRequest& request) override;
+    void notify_observers_batch(absl::Span<const SensorSample> batch) override;
 
 protected:
-    /// Daftar observer yang terdaftar
-    std::vector<std::shared_ptr<Observer>> observers_;
+    using ObserverList = std::vector<std::shared_ptr<Observer>>;
+
+    /**
+     * Ambil snapshot daftar observer saat ini (tanpa mutex).
+     * Valid sampai thread ini memanggil snapshot() lagi (utils::SnapshotCell::read()).
+     */
+    const ObserverList& snapshot() const;
+
+    /// Snapshot daftar observer
+    utils::SnapshotCell<ObserverList> observers_;
 
-    /// Mutex untuk thread-safety (gRPC concurrent requests)
-    std::mutex observer_mutex_;
+    /// Mutex untuk writer saja (add/remove); reader tidak pernah mengambilnya
+    std::mutex writer_mutex_;
 };
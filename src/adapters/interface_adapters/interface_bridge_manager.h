@@ -7,7 +7,8 @@
  */
 #pragma once
 #include <memory>
-#include "sensor.pb.h"
+#include <absl/types/span.h>
+#include "pipeline/sensor_sample.h"
 
 // Forward declaration -- hanya butuh nama class untuk parameter shared_ptr
 class ITransportAdapter;
@@ -19,6 +20,7 @@ class ITransportAdapter;
  * Bridge Manager bertanggung jawab:
  *   - add_adapter()           -> daftarkan transport adapter baru (WebSocket, DDS, dll)
  *   - broadcast_sensor_data() -> kirim data sensor ke SEMUA adapter yang terdaftar
+ *   - broadcast_sensor_batch() -> kirim satu batch data sensor ke SEMUA adapter
  * 
  * Konsep Bridge Pattern:
  *   Memisahkan "abstraksi" (apa yang mau dilakukan: broadcast data)
@@ -47,7 +49,14 @@ public:
     /**
      * Broadcast data sensor ke semua adapter yang terdaftar.
      * Setiap adapter akan memanggil send() masing-masing.
-     * @param request Data sensor dari gRPC yang akan dikirim
+     * @param sample Data sensor dari gRPC yang akan dikirim
      */
-    virtual void broadcast_sensor_data(const iot::SensorRequest& request) = 0;
+    virtual void broadcast_sensor_data(const SensorSample& sample) = 0;
+
+    /**
+     * Broadcast satu batch data sensor ke semua adapter yang terdaftar.
+     * Setiap adapter akan memanggil send_batch() masing-masing.
+     * @param batch Kumpulan data sensor yang akan dikirim
+     */
+    virtual void broadcast_sensor_batch(absl::Span<const SensorSample> batch) = 0;
 };
@@ -1,5 +1,7 @@
 #pragma once
-#include "sensor.pb.h"
+#include "pipeline/sensor_sample.h"
+#include <absl/types/span.h>
+#include <string>
 
 /**
  * ITransportAdapter Interface (Pure Virtual)
@@ -12,6 +14,9 @@
  *   - send() -> kirim satu data sensor melalui transport ini
  *   - name() -> nama adapter (untuk logging dan identifikasi)
  * 
+ * Method opsional (punya implementasi default):
+ *   - send_batch() -> kirim banyak data sekaligus (default: loop send())
+ * 
  * Concrete implementations dalam project ini:
  *   ITransportAdapter (interface)
  *       -> WebSocketAdapter : kirim data via WebSocket ke browser/frontend
@@ -35,9 +40,22 @@ public:
     /**
      * Kirim data sensor melalui transport ini.
      * Dipanggil oleh BridgeManager saat broadcast_sensor_data().
-     * @param request Data sensor yang akan dikirim
+     * @param sample Data sensor yang akan dikirim
+     */
+    virtual void send(const SensorSample& sample) = 0;
+
+    /**
+     * Kirim satu batch data sensor melalui transport ini.
+     * Default: panggil send() untuk setiap data. Adapter yang bisa
+     * mengirim batch lebih efisien (satu frame/sample untuk N data)
+     * cukup override method ini.
+     * @param batch Kumpulan data sensor yang akan dikirim
      */
-    virtual void send(const iot::SensorRequest& request) = 0;
+    virtual void send_batch(absl::Span<const SensorSample> batch) {
+        for (const auto& sample : batch) {
+            send(sample);
+        }
+    }
 
     /**
      * Nama adapter untuk keperluan logging dan identifikasi.
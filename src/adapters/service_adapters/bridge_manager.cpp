@@ -5,10 +5,13 @@
  * BridgeManager adalah pusat distribusi data sensor ke berbagai transport.
  * 
  * Alur data melalui BridgeManager:
- *   SensorController::SendSensorData()
- *       -> bridge_->broadcast_sensor_data(request)
- *           -> WebSocketAdapter::send()  (kirim JSON ke browser)
- *           -> DdsAdapter::send()        (kirim ke DDS network)
+ *   IngestPipeline (thread dispatcher)
+ *       -> bridge_->broadcast_sensor_batch(batch)
+ *           -> antrian WebSocket -> worker -> WebSocketAdapter::send_batch()
+ *           -> antrian DDS       -> worker -> DdsAdapter::send_batch()
+ *
+ * Thread pemanggil broadcast hanya memasukkan data ke antrian; waktu kirim
+ * tiap transport ditanggung oleh worker adapter itu sendiri.
  */
 #include "bridge_manager.h"
 #include <spdlog/spdlog.h>
@@ -19,34 +22,97 @@
  * Validasi: cek apakah adapter tidak null sebelum menambahkan.
  * Adapter yang null bisa terjadi jika ada error saat pembuatan object.
  * 
+ * Jika antrian aktif, satu BatchWorker (1 thread, urutan terjaga) dibuat
+ * khusus untuk adapter ini.
+ * 
  * @param adapter Shared pointer ke transport adapter
+ * @param config  Konfigurasi antrian adapter
  */
-void BridgeManager::add_adapter(std::shared_ptr<ITransportAdapter> adapter) {
+void BridgeManager::add_adapter(std::shared_ptr<ITransportAdapter> adapter,
+                                const AdapterQueueConfig& config) {
     if (!adapter) {
         spdlog::warn("Bridge: Attempted to add null adapter");
         return;  // Tolak adapter null, jangan crash
     }
-    
-    adapters_.push_back(adapter);  // Tambahkan ke daftar adapter
-    spdlog::info("Bridge: Adapter registered - {}", adapter->name());
+
+    AdapterSlot slot;
+    slot.adapter = adapter;
+    if (config.enabled) {
+        BatchWorkerConfig worker_config;
+        worker_config.queue_depth = config.queue_depth;
+        worker_config.threads = 1;  // Satu thread per adapter: urutan kirim terjaga
+        worker_config.max_batch = config.max_batch;
+        worker_config.overflow = config.overflow;
+
+        ITransportAdapter* target = adapter.get();
+        slot.worker = std::make_unique<BatchWorker<SensorSample>>(
+            "Bridge[" + adapter->name() + "]", worker_config,
+            [target](absl::Span<const SensorSample> batch) { target->send_batch(batch); });
+    }
+
+    adapters_.push_back(std::move(slot));  // Tambahkan ke daftar adapter
+    spdlog::info("Bridge: Adapter registered - {} ({})", adapter->name(),
+                 config.enabled ? "queued" : "inline");
 }
 
 /**
  * Broadcast data sensor ke semua adapter yang terdaftar.
  * 
- * Iterasi melalui semua adapter dan panggil send() satu per satu.
- * Jika salah satu adapter gagal, adapter lainnya tetap akan dipanggil
- * (tidak ada early return saat error di satu adapter).
+ * Iterasi melalui semua adapter dan masukkan data ke antrian masing-masing.
+ * Jika salah satu adapter lambat atau gagal, adapter lainnya tidak terpengaruh.
  * 
- * @param request Data sensor yang akan dikirim ke semua transport
+ * @param sample Data sensor yang akan dikirim ke semua transport
  */
-void BridgeManager::broadcast_sensor_data(const iot::SensorRequest& request) {
-    spdlog::debug("Bridge: Broadcasting sensor data - ID: {}", request.sensor_id());
+void BridgeManager::broadcast_sensor_data(const SensorSample& sample) {
+    spdlog::debug("Bridge: Broadcasting sensor data - ID: {}", sample.sensor_id);
     
     // Iterasi semua adapter dan kirim data
-    for (auto& adapter : adapters_) {
-        if (adapter) {          // Defensive check: pastikan adapter valid
-            adapter->send(request);  // Kirim data via transport adapter
+    for (auto& slot : adapters_) {
+        if (slot.worker) {
+            slot.worker->push(sample);    // Antrian adapter (policy adapter yang berlaku)
+        } else {
+            slot.adapter->send(sample);   // Mode inline: kirim langsung
+        }
+    }
+}
+
+/**
+ * Broadcast satu batch data sensor ke semua adapter yang terdaftar.
+ * 
+ * Sama seperti broadcast_sensor_data(), tetapi untuk seluruh batch.
+ * Worker adapter mengirim ulang per batch (send_batch), bukan per data.
+ * 
+ * @param batch Kumpulan data sensor yang akan dikirim ke semua transport
+ */
+void BridgeManager::broadcast_sensor_batch(absl::Span<const SensorSample> batch) {
+    if (batch.empty()) {
+        return;
+    }
+    spdlog::debug("Bridge: Broadcasting sensor batch - {} reading(s)", batch.size());
+
+    for (auto& slot : adapters_) {
+        if (slot.worker) {
+            slot.worker->push_batch(batch);
+        } else {
+            slot.adapter->send_batch(batch);
+        }
+    }
+}
+
+/**
+ * Snapshot statistik semua adapter, sesuai urutan pendaftaran.
+ */
+std::vector<AdapterStats> BridgeManager::adapter_stats() const {
+    std::vector<AdapterStats> result;
+    result.reserve(adapters_.size());
+    for (const auto& slot : adapters_) {
+        AdapterStats stats;
+        stats.name = slot.adapter->name();
+        stats.queued = slot.worker != nullptr;
+        if (slot.worker) {
+            stats.queue = slot.worker->stats();
         }
+        result.push_back(std::move(stats));
     }
+    return result;
 }
@@ -1,9 +1,34 @@
 #pragma once
 #include "adapters/interface_adapters/interface_transport_adapter.h"
+#include "pipeline/batch_worker.h"
 #include <vector>
 #include <memory>
+#include <string>
 #include "sensor.grpc.pb.h"
 
+/**
+ * Konfigurasi antrian per-adapter (dibaca dari environment variable di app.cpp).
+ *
+ * Setiap adapter punya antrian + SATU thread worker sendiri, sehingga
+ * urutan data per adapter tetap terjaga dan adapter yang lambat (misalnya
+ * DDS yang sedang menunggu reader) tidak menahan adapter lain.
+ */
+struct AdapterQueueConfig {
+    bool enabled = true;                                    // false: send() langsung di thread pemanggil
+    size_t queue_depth = 4096;                              // Kapasitas antrian adapter
+    size_t max_batch = 256;                                 // Maksimal data per send_batch()
+    OverflowPolicy overflow = OverflowPolicy::DROP_OLDEST;  // Kebijakan saat antrian adapter penuh
+};
+
+/**
+ * Statistik satu adapter (snapshot, untuk monitoring/logging).
+ */
+struct AdapterStats {
+    std::string name;         // Nama adapter (ITransportAdapter::name())
+    bool queued = false;      // true jika adapter memakai antrian sendiri
+    BatchWorkerStats queue;   // Kedalaman antrian dan counter drop (kosong jika !queued)
+};
+
 /**
  * BridgeManager -- Concrete Implementation dari IBridgeManager
  * 
@@ -13,7 +38,16 @@
  * Cara kerjanya sederhana:
  *   1. Adapter didaftarkan via add_adapter() saat startup (di init_bridge())
  *   2. Ketika data sensor masuk, SensorController memanggil broadcast_sensor_data()
- *   3. BridgeManager meng-iterasi semua adapter dan memanggil send() masing-masing
+ *   3. BridgeManager memasukkan data ke antrian MASING-MASING adapter
+ *   4. Thread worker tiap adapter memanggil send_batch() secara independen
+ *
+ *   broadcast_sensor_batch()
+ *       -> [antrian WebSocket] -> worker -> WebSocketAdapter::send_batch()
+ *       -> [antrian DDS]       -> worker -> DdsAdapter::send_batch()
+ *
+ * Jika satu adapter lambat, hanya antriannya yang penuh; overflow policy
+ * adapter itu yang menentukan nasib datanya (default: buang data terlama),
+ * sementara adapter lain tetap berjalan.
  * 
  * Adapter yang terdaftar saat ini:
  *   - WebSocketAdapter : kirim JSON ke browser via WebSocket
@@ -31,22 +65,47 @@ public:
     /**
      * Daftarkan adapter baru ke dalam daftar transport.
      * Adapter yang didaftarkan akan menerima data saat broadcast dipanggil.
+     * Panggil hanya saat startup (sebelum broadcast pertama).
      * @param adapter Shared pointer ke adapter (WebSocketAdapter, DdsAdapter, dll)
+     * @param config  Konfigurasi antrian khusus adapter ini
      */
-    void add_adapter(std::shared_ptr<ITransportAdapter> adapter);
+    void add_adapter(std::shared_ptr<ITransportAdapter> adapter,
+                     const AdapterQueueConfig& config = AdapterQueueConfig());
 
     /**
      * Kirim data sensor ke SEMUA adapter yang terdaftar.
-     * Iterasi satu per satu dan panggil send() pada masing-masing.
-     * @param request Data sensor dari gRPC yang akan di-broadcast
+     * Data dimasukkan ke antrian tiap adapter (atau send() langsung jika
+     * antrian adapter dinonaktifkan).
+     * @param sample Data sensor dari gRPC yang akan di-broadcast
      */
-    void broadcast_sensor_data(const iot::SensorRequest& request);
+    void broadcast_sensor_data(const SensorSample& sample);
+
+    /**
+     * Kirim satu batch data sensor ke SEMUA adapter yang terdaftar.
+     * Setiap adapter menerima data via send_batch() dari thread worker-nya.
+     * @param batch Kumpulan data sensor yang akan di-broadcast
+     */
+    void broadcast_sensor_batch(absl::Span<const SensorSample> batch);
+
+    /**
+     * Ambil snapshot statistik semua adapter (kedalaman antrian, drop, dll).
+     */
+    std::vector<AdapterStats> adapter_stats() const;
     
 private:
+    /**
+     * Satu adapter beserta antriannya.
+     * worker bernilai null jika antrian adapter dinonaktifkan.
+     */
+    struct AdapterSlot {
+        std::shared_ptr<ITransportAdapter> adapter;
+        std::unique_ptr<BatchWorker<SensorSample>> worker;
+    };
+
     /**
      * Daftar semua transport adapter yang terdaftar.
      * Menggunakan vector karena urutan pendaftaran mungkin penting,
      * dan jumlah adapter biasanya kecil (2-5 adapter).
      */
-    std::vector<std::shared_ptr<ITransportAdapter>> adapters_;
+    std::vector<AdapterSlot> adapters_;
 };
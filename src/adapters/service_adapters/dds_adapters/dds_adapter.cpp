@@ -2,7 +2,7 @@
  * dds_adapter.cpp -- Implementasi DdsAdapter
  * 
  * File ini berisi implementasi method-method DdsAdapter.
- * DdsAdapter menerjemahkan SensorRequest (protobuf) ke format
+ * DdsAdapter menerjemahkan SensorSample (representasi internal) ke format
  * yang dipahami oleh DdsPublisher (OpenDDS IDL).
  */
 #include "dds_adapter.h"
@@ -32,28 +32,29 @@ bool DdsAdapter::init() {
  * 
  * Proses:
  *   1. Cek apakah DDS publisher tersedia
- *   2. Ekstrak semua field dari SensorRequest (protobuf format)
+ *   2. Ekstrak semua field dari SensorSample; nama dan lokasi di-resolve
+ *      dari StringInterner sebagai referensi (tanpa copy std::string)
  *   3. Teruskan ke DdsPublisher::publish() yang akan mengirim via OpenDDS
  * 
- * @param request Data sensor dalam format protobuf
+ * @param sample Data sensor (representasi internal)
  */
-void DdsAdapter::send(const iot::SensorRequest& request) {
+void DdsAdapter::send(const SensorSample& sample) {
     if (!dds_publisher_) {
         spdlog::warn("DDS Adapter: Publisher not available");
         return;  // Tidak bisa kirim tanpa publisher
     }
 
-    // Ekstrak field protobuf dan teruskan ke DDS publisher
+    // Ekstrak field SensorSample dan teruskan ke DDS publisher
     // DdsPublisher akan mengkonversi ke format IDL (Messengger::Message)
     dds_publisher_->publish(
-        request.sensor_id(),         // ID sensor
-        request.sensor_name(),       // Nama sensor
-        request.temperature(),       // Suhu (Celsius)
-        request.humidity(),          // Kelembaban (%)
-        request.pressure(),          // Tekanan (hPa)
-        request.light_intensity(),   // Intensitas cahaya (lux)
-        request.timestamp(),         // Timestamp (epoch ms)
-        request.location()           // Lokasi sensor
+        sample.sensor_id,            // ID sensor
+        sample.sensor_name(),        // Nama sensor (referensi ke tabel intern)
+        sample.temperature,          // Suhu (Celsius)
+        sample.humidity,             // Kelembaban (%)
+        sample.pressure,             // Tekanan (hPa)
+        sample.light_intensity,      // Intensitas cahaya (lux)
+        sample.timestamp,            // Timestamp (epoch ms)
+        sample.location()            // Lokasi sensor (referensi ke tabel intern)
     );
     spdlog::debug("DDS Adapter: Sent message");
 }
@@ -12,7 +12,7 @@
  * 
  * Alur data:
  *   BridgeManager::broadcast_sensor_data()
- *       -> DdsAdapter::send(request)
+ *       -> DdsAdapter::send(sample)
  *           -> DdsPublisher::publish(id, name, temp, ...)
  *               -> OpenDDS network (RTPS protocol)
  * 
@@ -23,7 +23,7 @@
  * 
  * Class ini TIDAK memiliki logic DDS secara langsung.
  * Semua logic DDS ada di DdsPublisher. DdsAdapter hanya berperan
- * sebagai "adapter" yang menerjemahkan SensorRequest ke format DDS.
+ * sebagai "adapter" yang menerjemahkan SensorSample ke format DDS.
  */
 class DdsAdapter : public ITransportAdapter {
 public:
@@ -42,10 +42,10 @@ public:
 
     /**
      * Kirim data sensor ke DDS network.
-     * Mengekstrak field dari SensorRequest dan meneruskan ke DdsPublisher::publish().
-     * @param request Data sensor yang akan dikirim via DDS
+     * Mengekstrak field dari SensorSample dan meneruskan ke DdsPublisher::publish().
+     * @param sample Data sensor yang akan dikirim via DDS
      */
-    void send(const iot::SensorRequest& request) override;
+    void send(const SensorSample& sample) override;
 
     /**
      * Nama adapter untuk logging.
@@ -2,24 +2,78 @@
  * websocket_adapter.cpp -- Implementasi WebSocketAdapter
  * 
  * File ini berisi implementasi method-method WebSocketAdapter.
- * WebSocketAdapter mengkonversi data sensor (protobuf) ke JSON,
- * lalu mem-broadcast ke semua client WebSocket yang terhubung.
+ * WebSocketAdapter mengkonversi data sensor (SensorSample) ke JSON,
+ * lalu mengirimnya ke client WebSocket yang berlangganan data tersebut.
  */
 #include "websocket_adapter.h"
 #include "utils/json_helper.h"
 #include <spdlog/spdlog.h>
+#include <algorithm>
+#include <vector>
 
 /**
  * Constructor: simpan referensi ke WebSocket server.
  * Menggunakan initializer list untuk efisiensi.
+ * Mode conflation: jalankan thread flusher tick (hasil tick dikirim sebagai
+ * satu batch jika micro-batch juga aktif).
+ * Mode micro-batch saja: jalankan thread flusher berbasis latency.
  */
-WebSocketAdapter::WebSocketAdapter(std::shared_ptr<WsServer> ws_server)
-    : ws_server_(ws_server) {
+WebSocketAdapter::WebSocketAdapter(std::shared_ptr<IWsServer> ws_server,
+                                   const WebSocketAdapterConfig& config)
+    : ws_server_(ws_server), config_(config) {
+    config_.batch_max = std::max<size_t>(config_.batch_max, 1);
+    config_.batch_latency = std::max(config_.batch_latency, std::chrono::milliseconds(1));
+
+    if (config_.conflate) {
+        if (config_.tick_hz <= 0) {
+            config_.tick_hz = 20;
+        }
+        // Di atas ini tick < 1ms: flusher berputar terus tanpa mengurangi frame
+        config_.tick_hz = std::min(config_.tick_hz, WebSocketAdapterConfig::kMaxTickHz);
+        flusher_ = std::thread(&WebSocketAdapter::flush_loop, this);
+        spdlog::info("WebSocket Adapter: Conflation enabled ({} Hz{})", config_.tick_hz,
+                     config_.batch ? ", one batch frame per tick" : "");
+    } else if (config_.batch) {
+        flusher_ = std::thread(&WebSocketAdapter::batch_loop, this);
+        spdlog::info("WebSocket Adapter: Micro-batch enabled (max={}, latency={}ms)",
+                     config_.batch_max, config_.batch_latency.count());
+    }
+}
+
+/**
+ * Destructor: bangunkan flusher, tunggu flush terakhir selesai, lalu join.
+ * Mode micro-batch: counter akhir di-log.
+ */
+WebSocketAdapter::~WebSocketAdapter() {
+    if (flusher_.joinable()) {
+        if (config_.conflate) {
+            std::lock_guard<std::mutex> lock(stop_mutex_);
+            stopping_ = true;
+        } else {
+            std::lock_guard<std::mutex> lock(batch_mutex_);
+            batch_stopping_ = true;
+        }
+        stop_cv_.notify_all();
+        batch_cv_.notify_all();
+        flusher_.join();
+    }
+
+    if (config_.batch) {
+        WebSocketBatchStats stats = batch_stats();
+        uint64_t timed = stats.flushed_by_size + stats.flushed_by_time;  // Batch dari akumulator (bukan tick)
+        spdlog::info("WebSocket Adapter: Micro-batch stats (frames={}, readings={}, avg_batch={:.1f}, "
+                     "by_size={}, by_time={}, avg_latency={}us, max_latency={}us)",
+                     stats.frames, stats.readings,
+                     stats.frames ? static_cast<double>(stats.readings) / stats.frames : 0.0,
+                     stats.flushed_by_size, stats.flushed_by_time,
+                     timed ? stats.total_latency_us / timed : 0,
+                     stats.max_latency_us);
+    }
 }
 
 /**
  * Inisialisasi adapter.
- * Saat ini tidak melakukan apa-apa karena WsServer
+ * Saat ini tidak melakukan apa-apa karena server WebSocket
  * sudah diinisialisasi terlebih dahulu di main().
  * Method ini ada untuk memenuhi kontrak ITransportAdapter.
  */
@@ -29,29 +83,270 @@ bool WebSocketAdapter::init() {
 }
 
 /**
- * Kirim data sensor ke semua WebSocket client.
+ * Kirim data sensor ke WebSocket client.
+ * 
+ * Mode conflation: hanya simpan ke LatestValueTable (dikirim di tick berikutnya).
+ * Mode micro-batch: tambahkan ke batch (dikirim saat batch penuh atau latency tercapai).
  * 
  * Proses:
  *   1. Cek apakah WebSocket server tersedia
- *   2. Konversi SensorRequest ke format JSON menggunakan utils::sensor_to_json()
- *   3. Broadcast JSON ke semua client yang terhubung via WsServer::broadcast()
+ *   2. Konversi SensorSample ke format JSON menggunakan utils::sensor_to_json()
+ *   3. Kirim JSON ke client yang berlangganan data ini via IWsServer::publish()
+ *      (client tanpa filter menerima semua data)
  * 
  * Format JSON yang dikirim:
  *   {"sensor_id": 1, "temperature": 25.5, "humidity": 60.0, "location": "Room A"}
  * 
- * @param request Data sensor dalam format protobuf
+ * @param sample Data sensor (representasi internal)
+ */
+void WebSocketAdapter::send(const SensorSample& sample) {
+    if (config_.conflate) {
+        latest_.upsert(sample);
+        return;
+    }
+    if (config_.batch) {
+        append_to_batch(absl::Span<const SensorSample>(&sample, 1));
+        return;
+    }
+    publish(sample);
+}
+
+/**
+ * Kirim satu batch data sensor.
+ * Mode conflation: satu lock untuk seluruh batch; jika sensor yang sama
+ * muncul beberapa kali, hanya data terakhir yang tersisa.
+ * Mode micro-batch: seluruh batch ditambahkan dengan satu lock.
+ * Mode langsung: publish satu per satu (sama seperti default).
+ * 
+ * @param batch Kumpulan data sensor
+ */
+void WebSocketAdapter::send_batch(absl::Span<const SensorSample> batch) {
+    if (config_.conflate) {
+        latest_.upsert_batch(batch);
+        return;
+    }
+    if (config_.batch) {
+        append_to_batch(batch);
+        return;
+    }
+    for (const auto& sample : batch) {
+        publish(sample);
+    }
+}
+
+/**
+ * Loop thread flusher (mode conflation).
+ * 
+ * Setiap tick: ambil sensor yang berubah sejak tick sebelumnya lalu publish
+ * nilai terbarunya (satu frame JSON array jika micro-batch aktif). Tick berikutnya dijadwalkan dari tick sebelumnya
+ * (bukan dari akhir flush) agar frekuensi stabil. Saat stop, sisa data
+ * yang berubah tetap dikirim sebelum thread keluar.
+ */
+void WebSocketAdapter::flush_loop() {
+    const auto tick = std::chrono::microseconds(1000000 / config_.tick_hz);
+    std::vector<SensorSample> dirty;
+    auto next_tick = std::chrono::steady_clock::now() + tick;
+
+    for (;;) {
+        bool stop;
+        {
+            std::unique_lock<std::mutex> lock(stop_mutex_);
+            stop = stop_cv_.wait_until(lock, next_tick, [this] { return stopping_; });
+        }
+
+        latest_.take_dirty(dirty);
+        if (config_.batch) {
+            publish_batch(dirty);
+        } else {
+            for (const auto& sample : dirty) {
+                publish(sample);
+            }
+        }
+
+        if (stop) {
+            break;
+        }
+        next_tick += tick;
+        auto now = std::chrono::steady_clock::now();
+        if (next_tick < now) {
+            next_tick = now + tick;  // Flush lebih lama dari satu tick: jangan menumpuk tick
+        }
+    }
+}
+
+/**
+ * Tambahkan data ke micro-batch.
+ * 
+ * Serialisasi JSON dilakukan di thread pemanggil SEBELUM lock, jadi lock
+ * hanya melindungi push ke vector. Data pertama dalam batch mencatat waktu
+ * mulai dan membangunkan flusher (yang lalu menunggu sampai batch_latency).
+ * Batch penuh diambil di bawah lock lalu dikirim SETELAH lock dilepas;
+ * send_ready_batch() menjaga urutan antar batch (tiket), karena flusher
+ * bisa mengambil batch berikutnya sebelum batch ini selesai dikirim.
+ * 
+ * @param samples Data sensor
+ */
+void WebSocketAdapter::append_to_batch(absl::Span<const SensorSample> samples) {
+    std::vector<std::string> jsons;
+    jsons.reserve(samples.size());
+    for (const auto& sample : samples) {
+        jsons.push_back(utils::sensor_to_json(sample));
+    }
+
+    std::vector<ReadyBatch> ready;
+    {
+        std::lock_guard<std::mutex> lock(batch_mutex_);
+        for (size_t i = 0; i < samples.size(); ++i) {
+            if (pending_.empty()) {
+                pending_since_ = std::chrono::steady_clock::now();
+                batch_cv_.notify_one();
+            }
+            pending_.push_back(samples[i]);
+            pending_json_.push_back(std::move(jsons[i]));
+
+            if (pending_.size() >= config_.batch_max) {
+                ready.emplace_back();
+                take_batch_locked(true, ready.back());  // Batas ukuran tercapai
+            }
+        }
+    }
+
+    for (const auto& batch : ready) {
+        send_ready_batch(batch);
+    }
+}
+
+/**
+ * Pindahkan micro-batch ke `out` (swap, tanpa salin) dan hitung latency
+ * (lama data tertua menunggu). Akumulator mulai lagi dengan kapasitas batch_max.
+ */
+bool WebSocketAdapter::take_batch_locked(bool by_size, ReadyBatch& out) {
+    if (pending_.empty()) {
+        return false;
+    }
+
+    auto waited = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - pending_since_).count();
+    out.latency_us = static_cast<uint64_t>(std::max<int64_t>(waited, 0));
+    out.by_size = by_size;
+    out.samples.clear();
+    out.jsons.clear();
+    out.samples.swap(pending_);
+    out.jsons.swap(pending_json_);
+    pending_.reserve(config_.batch_max);
+    pending_json_.reserve(config_.batch_max);
+    out.ticket = next_ticket_++;
+    return true;
+}
+
+/**
+ * Kirim micro-batch sebagai satu frame JSON array per client lalu catat counter.
+ * Tunggu giliran tiket batch ini dulu: tanpa itu, batch yang diambil lebih
+ * dulu bisa terkirim setelah batch berikutnya (thread pengirim berbeda).
+ */
+void WebSocketAdapter::send_ready_batch(const ReadyBatch& batch) {
+    {
+        std::unique_lock<std::mutex> lock(send_mutex_);
+        send_cv_.wait(lock, [this, &batch] { return next_send_ == batch.ticket; });
+        if (ws_server_) {
+            ws_server_->publish_batch(batch.samples, batch.jsons);
+        } else {
+            spdlog::warn("WebSocket Adapter: Server not available");
+        }
+        ++next_send_;
+    }
+    send_cv_.notify_all();
+
+    batch_frames_.fetch_add(1, std::memory_order_relaxed);
+    batch_readings_.fetch_add(batch.samples.size(), std::memory_order_relaxed);
+    (batch.by_size ? flushed_by_size_ : flushed_by_time_).fetch_add(1, std::memory_order_relaxed);
+    total_latency_us_.fetch_add(batch.latency_us, std::memory_order_relaxed);
+    uint64_t max_latency = max_latency_us_.load(std::memory_order_relaxed);
+    while (batch.latency_us > max_latency &&
+           !max_latency_us_.compare_exchange_weak(max_latency, batch.latency_us, std::memory_order_relaxed)) {
+    }
+    spdlog::debug("WebSocket Adapter: Sent batch ({} reading(s), waited {}us)",
+                  batch.samples.size(), batch.latency_us);
+}
+
+/**
+ * Loop thread flusher (mode micro-batch).
+ * Tidur sampai ada batch, lalu tunggu sampai data tertua mencapai
+ * batch_latency. Jika batch belum dikirim karena ukuran, ambil lalu kirim
+ * dengan lock dilepas. Saat shutdown, sisa batch dikirim sebelum thread berhenti.
+ */
+void WebSocketAdapter::batch_loop() {
+    ReadyBatch ready;
+    std::unique_lock<std::mutex> lock(batch_mutex_);
+    while (!batch_stopping_) {
+        if (pending_.empty()) {
+            batch_cv_.wait(lock);
+            continue;
+        }
+
+        auto deadline = pending_since_ + config_.batch_latency;
+        if (std::chrono::steady_clock::now() >= deadline) {
+            take_batch_locked(false, ready);  // Batas latency tercapai
+            lock.unlock();
+            send_ready_batch(ready);
+            lock.lock();
+            continue;
+        }
+        batch_cv_.wait_until(lock, deadline);
+    }
+    if (take_batch_locked(false, ready)) {
+        lock.unlock();
+        send_ready_batch(ready);
+    }
+}
+
+/**
+ * Serialisasi sekumpulan data lalu kirim sebagai satu frame JSON array
+ * (dipakai flusher conflation saat micro-batch aktif).
+ * 
+ * @param samples Data sensor (no-op jika kosong)
  */
-void WebSocketAdapter::send(const iot::SensorRequest& request) {
+void WebSocketAdapter::publish_batch(absl::Span<const SensorSample> samples) {
+    if (samples.empty()) {
+        return;
+    }
+    if (!ws_server_) {
+        spdlog::warn("WebSocket Adapter: Server not available");
+        return;
+    }
+
+    std::vector<std::string> jsons;
+    jsons.reserve(samples.size());
+    for (const auto& sample : samples) {
+        jsons.push_back(utils::sensor_to_json(sample));
+    }
+    ws_server_->publish_batch(samples, jsons);
+
+    batch_frames_.fetch_add(1, std::memory_order_relaxed);
+    batch_readings_.fetch_add(samples.size(), std::memory_order_relaxed);
+}
+
+/**
+ * Serialisasi dan publish satu data sensor.
+ * 
+ * Proses:
+ *   1. Cek apakah WebSocket server tersedia
+ *   2. Konversi SensorSample ke format JSON
+ *   3. Kirim ke client yang berlangganan via IWsServer::publish()
+ * 
+ * @param sample Data sensor (representasi internal)
+ */
+void WebSocketAdapter::publish(const SensorSample& sample) {
     if (!ws_server_) {
         spdlog::warn("WebSocket Adapter: Server not available");
         return;  // Tidak bisa kirim tanpa server
     }
 
-    // Konversi protobuf ke JSON string menggunakan RapidJSON
-    std::string json_payload = utils::sensor_to_json(&request);
+    // Konversi SensorSample ke JSON string menggunakan RapidJSON (tepi sistem)
+    std::string json_payload = utils::sensor_to_json(sample);
 
-    // Broadcast ke semua client WebSocket yang terhubung
-    ws_server_->broadcast(json_payload);
+    // Kirim ke client WebSocket yang filter langganannya cocok
+    ws_server_->publish(sample, json_payload);
     spdlog::debug("WebSocket Adapter: Sent message");
 }
 
@@ -62,3 +357,14 @@ void WebSocketAdapter::send(const iot::SensorRequest& request) {
 std::string WebSocketAdapter::name() const {
     return "WebSocket";
 }
+
+WebSocketBatchStats WebSocketAdapter::batch_stats() const {
+    WebSocketBatchStats stats;
+    stats.frames = batch_frames_.load(std::memory_order_relaxed);
+    stats.readings = batch_readings_.load(std::memory_order_relaxed);
+    stats.flushed_by_size = flushed_by_size_.load(std::memory_order_relaxed);
+    stats.flushed_by_time = flushed_by_time_.load(std::memory_order_relaxed);
+    stats.max_latency_us = max_latency_us_.load(std::memory_order_relaxed);
+    stats.total_latency_us = total_latency_us_.load(std::memory_order_relaxed);
+    return stats;
+}
@@ -1,7 +1,44 @@
 #pragma once
 #include "adapters/interface_adapters/interface_transport_adapter.h"
-#include "websocket/ws_server.h"
+#include "websocket/interface_ws_server.h"
+#include "pipeline/latest_value_table.h"
+#include <absl/types/span.h>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * Konfigurasi WebSocketAdapter.
+ */
+struct WebSocketAdapterConfig {
+    static constexpr int kMaxTickHz = 1000;  // Batas atas tick_hz (tick 1ms)
+
+    bool conflate = false;  // true = kirim nilai terbaru per sensor setiap tick
+    int tick_hz = 20;       // Frekuensi flush saat conflate (maks. 1 data/sensor/tick), dibatasi kMaxTickHz
+
+    bool batch = false;                              // true = gabungkan data menjadi satu frame JSON array
+    size_t batch_max = 256;                          // Flush saat batch berisi sebanyak ini
+    std::chrono::milliseconds batch_latency{10};     // Batas tunggu data tertua di batch
+};
+
+/**
+ * Counter mode micro-batch (lihat WebSocketAdapter::batch_stats()).
+ */
+struct WebSocketBatchStats {
+    uint64_t frames = 0;            // Batch yang dikirim (satu frame per client, termasuk tick conflation)
+    uint64_t readings = 0;          // Data yang dikirim lewat batch
+    uint64_t flushed_by_size = 0;   // Batch yang dikirim karena penuh
+    uint64_t flushed_by_time = 0;   // Batch yang dikirim karena batas latency
+    // Latency hanya untuk batch akumulator (flushed_by_size + flushed_by_time)
+    uint64_t max_latency_us = 0;    // Tunggu terlama data tertua (masuk -> kirim)
+    uint64_t total_latency_us = 0;  // Jumlah tunggu data tertua (untuk rata-rata)
+};
 
 /**
  * WebSocketAdapter -- Concrete Transport Adapter untuk WebSocket
@@ -9,45 +46,77 @@
  * Adapter ini menjembatani SensorController ke WebSocket server.
  * Ketika data sensor masuk via gRPC, BridgeManager memanggil send()
  * pada WebSocketAdapter, yang kemudian:
- *   1. Mengkonversi SensorRequest (protobuf) ke format JSON
- *   2. Mem-broadcast JSON tersebut ke semua client WebSocket yang terhubung
+ *   1. Mengkonversi SensorSample ke format JSON
+ *   2. Mengirim JSON tersebut ke client WebSocket yang berlangganan (filter per client)
  * 
  * Alur data:
  *   BridgeManager::broadcast_sensor_data()
- *       -> WebSocketAdapter::send(request)
- *           -> utils::sensor_to_json(request)  (konversi ke JSON)
- *           -> WsServer::broadcast(json)       (kirim ke semua client)
+ *       -> WebSocketAdapter::send(sample)
+ *           -> utils::sensor_to_json(sample)   (konversi ke JSON)
+ *           -> IWsServer::publish(sample, json) (kirim ke client yang berlangganan)
  * 
  * WebSocket digunakan untuk:
  *   - Streaming data real-time ke browser/dashboard
  *   - Koneksi persistent (tidak perlu polling seperti HTTP)
  *   - Komunikasi bidirectional antara server dan client
  * 
+ * Mode conflation (WS_CONFLATE=on):
+ *   send()/send_batch() hanya menyimpan data ke LatestValueTable. Thread
+ *   flusher setiap tick (1/tick_hz detik) mengambil sensor yang berubah
+ *   lalu mengirim nilai terbarunya. Laju keluar ke client dibatasi
+ *   (jumlah sensor x tick_hz), berapa pun laju data masuk.
+ * 
+ * Mode micro-batch (WS_BATCH_MODE=on):
+ *   Setiap data tetap diserialisasi ke JSON saat masuk, tetapi dikumpulkan
+ *   dan dikirim sebagai SATU text frame berisi JSON array jika:
+ *     - batch sudah berisi batch_max data, atau
+ *     - data tertua sudah menunggu batch_latency (thread flusher)
+ *   Overhead header frame + syscall dibayar sekali per batch, bukan per data.
+ *   Jika conflation juga aktif, hasil setiap tick dikirim sebagai satu batch.
+ * 
  * Class ini TIDAK memiliki logic WebSocket secara langsung.
- * Semua logic WebSocket ada di WsServer. WebSocketAdapter hanya berperan
- * sebagai "adapter" yang menerjemahkan SensorRequest ke format JSON.
+ * Semua logic WebSocket ada di backend IWsServer (WsServer / UwsServer).
+ * WebSocketAdapter hanya berperan sebagai "adapter" yang menerjemahkan SensorSample ke format JSON.
  */
 class WebSocketAdapter : public ITransportAdapter {
 public:
     /**
      * Constructor: terima shared pointer ke WebSocket server.
-     * WsServer sudah dibuat di main() sebelum adapter dibuat.
+     * Server (WsServer atau UwsServer, lihat WS_BACKEND) sudah dibuat di
+     * main() sebelum adapter dibuat.
+     * Jika config.conflate atau config.batch aktif, thread flusher langsung dijalankan.
      * @param ws_server Instance WebSocket server yang aktif
+     * @param config    Mode pengiriman (langsung, conflation, dan/atau micro-batch)
      */
-    explicit WebSocketAdapter(std::shared_ptr<WsServer> ws_server);
+    explicit WebSocketAdapter(std::shared_ptr<IWsServer> ws_server,
+                              const WebSocketAdapterConfig& config = {});
+
+    /**
+     * Destructor: hentikan flusher (jika ada) setelah flush terakhir,
+     * lalu log counter micro-batch.
+     */
+    ~WebSocketAdapter() override;
     
     /**
      * Inisialisasi adapter. Saat ini hanya log bahwa adapter siap.
-     * @return true selalu (WsServer sudah diinit di main())
+     * @return true selalu (server sudah diinit di main())
      */
     bool init() override;
 
     /**
-     * Kirim data sensor ke semua WebSocket client.
-     * Mengkonversi SensorRequest ke JSON lalu broadcast.
-     * @param request Data sensor yang akan dikirim via WebSocket
+     * Kirim data sensor ke WebSocket client yang berlangganan data ini.
+     * Mengkonversi SensorSample ke JSON lalu publish.
+     * @param sample Data sensor yang akan dikirim via WebSocket
+     */
+    void send(const SensorSample& sample) override;
+
+    /**
+     * Kirim satu batch data sensor.
+     * Mode conflation: seluruh batch masuk LatestValueTable dengan satu lock.
+     * Mode micro-batch: seluruh batch masuk batch yang sedang dikumpulkan (satu lock).
+     * @param batch Kumpulan data sensor
      */
-    void send(const iot::SensorRequest& request) override;
+    void send_batch(absl::Span<const SensorSample> batch) override;
 
     /**
      * Nama adapter untuk logging.
@@ -55,6 +124,92 @@ public:
      */
     std::string name() const override;
 
+    /**
+     * Counter mode micro-batch saat ini (semua nol jika batch tidak aktif).
+     */
+    WebSocketBatchStats batch_stats() const;
+
 private:
-    std::shared_ptr<WsServer> ws_server_;  // Referensi ke WebSocket server
+    /**
+     * Serialisasi satu data ke JSON lalu publish ke client yang berlangganan.
+     */
+    void publish(const SensorSample& sample);
+
+    /**
+     * Serialisasi data lalu kirim sebagai satu frame JSON array (publish_batch).
+     */
+    void publish_batch(absl::Span<const SensorSample> samples);
+
+    /**
+     * Tambahkan data ke micro-batch; kirim jika batch penuh.
+     */
+    void append_to_batch(absl::Span<const SensorSample> samples);
+
+    /**
+     * Micro-batch yang sudah diambil dari akumulator, siap dikirim tanpa lock.
+     */
+    struct ReadyBatch {
+        std::vector<SensorSample> samples;
+        std::vector<std::string> jsons;  // jsons[i] milik samples[i]
+        uint64_t latency_us = 0;         // Lama data tertua menunggu
+        bool by_size = false;            // true jika dipicu batch penuh (untuk counter)
+        uint64_t ticket = 0;             // Urutan pengambilan (send_ready_batch mengirim sesuai urutan ini)
+    };
+
+    /**
+     * Pindahkan micro-batch yang sedang dikumpulkan ke `out` lalu kosongkan
+     * dan beri nomor tiket urut. Harus dipanggil dengan batch_mutex_ terkunci.
+     * @return false jika batch kosong
+     */
+    bool take_batch_locked(bool by_size, ReadyBatch& out);
+
+    /**
+     * Kirim batch hasil take_batch_locked() lalu catat counter.
+     * Dipanggil TANPA batch_mutex_, agar fan-out ke client tidak menahan
+     * thread yang sedang menambah data ke batch. Batch dikirim sesuai
+     * urutan tiket: pemanggil menunggu sampai semua batch sebelumnya
+     * terkirim, jadi client menerima data dalam urutan masuknya.
+     */
+    void send_ready_batch(const ReadyBatch& batch);
+
+    /**
+     * Loop thread flusher (mode conflation): setiap tick kirim sensor yang berubah.
+     */
+    void flush_loop();
+
+    /**
+     * Loop thread flusher (mode micro-batch): kirim batch yang data
+     * tertuanya melewati batch_latency.
+     */
+    void batch_loop();
+
+    std::shared_ptr<IWsServer> ws_server_;  // Referensi ke WebSocket server
+    WebSocketAdapterConfig config_;
+
+    // Mode conflation
+    LatestValueTable latest_;               // Nilai terbaru per sensor
+    std::thread flusher_;                   // Flusher conflation ATAU micro-batch
+    std::mutex stop_mutex_;
+    std::condition_variable stop_cv_;
+    bool stopping_ = false;                 // Dilindungi stop_mutex_
+
+    // Mode micro-batch (tanpa conflation)
+    std::vector<SensorSample> pending_;                    // Data yang sedang dikumpulkan
+    std::vector<std::string> pending_json_;                // JSON data tsb (pending_json_[i] milik pending_[i])
+    std::chrono::steady_clock::time_point pending_since_;  // Waktu data pertama masuk batch
+    std::mutex batch_mutex_;                               // Melindungi pending_*
+    std::condition_variable batch_cv_;                     // Membangunkan flusher
+    bool batch_stopping_ = false;                          // Dilindungi batch_mutex_
+    uint64_t next_ticket_ = 0;                             // Tiket batch berikutnya (dilindungi batch_mutex_)
+    std::mutex send_mutex_;                                // Serialisasi publish micro-batch
+    std::condition_variable send_cv_;                      // Giliran kirim berikutnya
+    uint64_t next_send_ = 0;                               // Tiket yang boleh dikirim (dilindungi send_mutex_)
+
+    // Counter micro-batch (lihat WebSocketBatchStats)
+    std::atomic<uint64_t> batch_frames_{0};
+    std::atomic<uint64_t> batch_readings_{0};
+    std::atomic<uint64_t> flushed_by_size_{0};
+    std::atomic<uint64_t> flushed_by_time_{0};
+    std::atomic<uint64_t> max_latency_us_{0};
+    std::atomic<uint64_t> total_latency_us_{0};
 };
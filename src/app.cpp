@@ -19,19 +19,25 @@
  *     -> run_grpc_server()        (blocking, menunggu request masuk)
  * 
  * Arsitektur:
- *   gRPC Client --> SensorController --> Observer Pattern (log, validate)
- *                                    --> Bridge Pattern (WebSocket, DDS)
+ *   gRPC Client --> SensorController --> IngestPipeline --> Observer Pattern (log, validate)
+ *                                      (antrian)        --> Bridge Pattern (WebSocket, DDS)
  */
 #include "utils/log_util/logger.h"
 #include "controllers/sensor_controller.h"
+#include "controllers/async_sensor_controller.h"
 #include "websocket/ws_server.h"
+#include "websocket/uws_server.h"
 #include "dds/dds_publisher.h"
 #include "adapters/service_adapters/bridge_manager.h"
 #include "adapters/service_adapters/websocket_adapters/websocket_adapter.h"
 #include "adapters/service_adapters/dds_adapters/dds_adapter.h"
 #include "handlers/sensor_data_log_handler/sensor_data_log_handler.h"
 #include "handlers/sensor_data_validator/sensor_data_validator.h"
+#include "pipeline/ingest_pipeline.h"
+#include "pipeline/stats_reporter.h"
 #include <grpcpp/grpcpp.h>
+#include <algorithm>
+#include <chrono>
 #include <memory>
 #include <thread>
 #include <cstdlib>
@@ -43,12 +49,13 @@
  * Tidak bisa diakses dari file lain (internal linkage).
  * 
  * Variabel ini dibuat global karena digunakan oleh beberapa fungsi:
- *   - g_ws_server : WebSocket server, dipakai oleh run_ws_server() dan init_bridge()
+ *   - g_ws_server : WebSocket server (backend dipilih via WS_BACKEND),
+ *                   dipakai oleh run_ws_server() dan init_bridge()
  *   - g_dds_pub   : DDS publisher, dipakai oleh main() dan init_bridge()
  *   - g_bridge    : Bridge manager, dipakai oleh init_bridge() dan run_grpc_server()
  */
 namespace {
-std::shared_ptr<WsServer> g_ws_server;     // Instance WebSocket server (shared ownership)
+std::shared_ptr<IWsServer> g_ws_server;    // Instance WebSocket server (shared ownership)
 std::shared_ptr<DdsPublisher> g_dds_pub;   // Instance DDS publisher (shared ownership)
 std::shared_ptr<BridgeManager> g_bridge;   // Instance bridge manager (shared ownership)
 
@@ -88,51 +95,249 @@ int get_env_int(const char* name, int fallback) {
     }
 }
 
+/**
+ * Baca konfigurasi IngestPipeline dari environment variable.
+ * 
+ * Environment variables:
+ *   - INGEST_PIPELINE    : "off" untuk memproses inline di thread gRPC (default: on)
+ *   - INGEST_QUEUE_DEPTH : kapasitas antrian (default: 8192)
+ *   - INGEST_DISPATCHERS : jumlah thread dispatcher (default: 1, urutan data terjaga)
+ *   - INGEST_BATCH_MAX   : maksimal data per dispatch (default: 256)
+ *   - INGEST_OVERFLOW    : "block", "drop_oldest", atau "reject"
+ *                          (default: "block" untuk GRPC_MODE=sync, "reject" untuk async)
+ * 
+ * Mode async TIDAK boleh menunggu di thread Completion Queue: satu antrian
+ * penuh akan menahan semua RPC lain di CQ yang sama. Karena itu default-nya
+ * REJECT (client menerima RESOURCE_EXHAUSTED), dan "block" dengan mode async
+ * diberi peringatan saat startup.
+ * 
+ * @param async_mode true jika server berjalan dengan GRPC_MODE=async
+ * @return Konfigurasi pipeline untuk SensorController/AsyncSensorController
+ */
+IngestPipelineConfig load_pipeline_config(bool async_mode) {
+    IngestPipelineConfig config;
+    config.enabled = get_env_string("INGEST_PIPELINE", "on") != "off";
+    config.queue_depth = static_cast<size_t>(std::max(get_env_int("INGEST_QUEUE_DEPTH", 8192), 1));
+    config.dispatcher_threads = static_cast<size_t>(std::max(get_env_int("INGEST_DISPATCHERS", 1), 1));
+    config.max_batch = static_cast<size_t>(std::max(get_env_int("INGEST_BATCH_MAX", 256), 1));
+    OverflowPolicy default_overflow = async_mode ? OverflowPolicy::REJECT : OverflowPolicy::BLOCK;
+    config.overflow = utils::parse_overflow_policy(
+        get_env_string("INGEST_OVERFLOW", utils::overflow_policy_name(default_overflow)), default_overflow);
+    if (async_mode && config.enabled && config.overflow == OverflowPolicy::BLOCK) {
+        spdlog::warn("[gRPC] INGEST_OVERFLOW=block with GRPC_MODE=async: a full ingest queue "
+                     "stalls every RPC on the same completion queue");
+    }
+    return config;
+}
+
+/**
+ * Baca konfigurasi antrian satu adapter di BridgeManager.
+ * 
+ * Environment variables (PREFIX = "BRIDGE_WS" atau "BRIDGE_DDS"):
+ *   - BRIDGE_QUEUE         : "off" untuk memanggil adapter langsung (default: on)
+ *   - BRIDGE_BATCH_MAX     : maksimal data per send_batch() (default: 256)
+ *   - <PREFIX>_QUEUE_DEPTH : kapasitas antrian adapter (default: 4096)
+ *   - <PREFIX>_OVERFLOW    : "drop_oldest" (default), "drop_newest", atau "block"
+ * 
+ * @param prefix Prefix nama environment variable adapter
+ * @return Konfigurasi antrian untuk BridgeManager::add_adapter()
+ */
+AdapterQueueConfig load_adapter_queue_config(const std::string& prefix) {
+    AdapterQueueConfig config;
+    config.enabled = get_env_string("BRIDGE_QUEUE", "on") != "off";
+    config.max_batch = static_cast<size_t>(std::max(get_env_int("BRIDGE_BATCH_MAX", 256), 1));
+    config.queue_depth = static_cast<size_t>(std::max(get_env_int((prefix + "_QUEUE_DEPTH").c_str(), 4096), 1));
+    config.overflow = utils::parse_overflow_policy(
+        get_env_string((prefix + "_OVERFLOW").c_str(), "drop_oldest"), OverflowPolicy::DROP_OLDEST);
+    if (config.overflow == OverflowPolicy::REJECT) {
+        // Tidak ada pihak yang bisa menerima penolakan di sisi adapter
+        config.overflow = OverflowPolicy::DROP_NEWEST;
+    }
+    return config;
+}
+
+/**
+ * Baca konfigurasi sampling SensorDataLogHandler dari environment variable.
+ * 
+ * Environment variables:
+ *   - LOG_SAMPLING         : "all" (default), "every_n", atau "rate"
+ *   - LOG_SAMPLE_EVERY_N   : mode every_n, log 1 dari N data per sensor (default: 100)
+ *   - LOG_SAMPLE_RATE      : mode rate, maksimal record/detik per sensor (default: 1)
+ *   - LOG_SAMPLE_ANOMALIES : "on" (default) = data anomali selalu di-log
+ * 
+ * @return Konfigurasi sampling untuk SensorDataLogHandler
+ */
+LogSamplingConfig load_log_sampling_config() {
+    LogSamplingConfig config;
+    config.mode = utils::parse_log_sampling_mode(get_env_string("LOG_SAMPLING", "all"),
+                                                 LogSamplingMode::ALL);
+    config.every_n = static_cast<uint32_t>(std::max(get_env_int("LOG_SAMPLE_EVERY_N", 100), 1));
+    config.per_second = static_cast<uint32_t>(std::max(get_env_int("LOG_SAMPLE_RATE", 1), 1));
+    config.always_log_anomalies = (get_env_string("LOG_SAMPLE_ANOMALIES", "on") == "on");
+    return config;
+}
+
+/**
+ * Buat SensorDataLogHandler sesuai sink dan sampling yang dipilih.
+ * 
+ * Environment variables:
+ *   - LOG_SINK              : "text" (default), "binary" (journal saja), atau "both"
+ *   - LOG_JOURNAL_DIR       : folder file journal (default: "journal")
+ *   - LOG_JOURNAL_FILE_MB   : ukuran satu file journal (default: 64)
+ *   - LOG_JOURNAL_MAX_FILES : jumlah file journal yang disimpan (default: 8)
+ *   - LOG_SAMPLING*         : lihat load_log_sampling_config()
+ * 
+ * Jika journal gagal dibuka, handler kembali ke log teks.
+ * 
+ * @return Observer logging untuk register_observers()
+ */
+std::shared_ptr<SensorDataLogHandler> create_log_handler() {
+    std::string sink = get_env_string("LOG_SINK", "text");
+    std::shared_ptr<BinaryJournal> journal;
+    if (sink == "binary" || sink == "both") {
+        BinaryJournalConfig journal_config;
+        journal_config.directory = get_env_string("LOG_JOURNAL_DIR", "journal");
+        int file_mb = std::max(get_env_int("LOG_JOURNAL_FILE_MB", 64), 1);
+        journal_config.file_bytes = static_cast<size_t>(file_mb) * 1024 * 1024;
+        journal_config.max_files = static_cast<size_t>(std::max(get_env_int("LOG_JOURNAL_MAX_FILES", 8), 1));
+        journal = std::make_shared<BinaryJournal>(journal_config);
+        if (!journal->open()) {
+            spdlog::warn("[DataLogger] Binary journal unavailable, falling back to text log");
+            journal.reset();
+        }
+    }
+    bool text_log = (sink != "binary");
+    return std::make_shared<SensorDataLogHandler>(load_log_sampling_config(), journal, text_log);
+}
+
+/**
+ * Daftarkan concrete observers ke controller (sync maupun async).
+ * Setelah ini, setiap data sensor masuk akan otomatis di-log dan di-validasi.
+ *
+ * @param observable Controller yang berperan sebagai Observable
+ */
+void register_observers(Observable& observable) {
+    auto log_handler = create_log_handler();                     // Observer #1: logging
+    auto validator   = std::make_shared<SensorDataValidator>();   // Observer #2: validasi
+
+    observable.add_observer(log_handler);
+    observable.add_observer(validator);
+
+    spdlog::info("Observers: Registered {} handler(s) to SensorController", 2);
+}
+
+/**
+ * Mulai laporan statistik berkala: isi antrian dan counter drop/reject
+ * IngestPipeline serta antrian setiap adapter di BridgeManager, dan
+ * peringatan jika logger async membuang record sejak laporan sebelumnya.
+ * 
+ * Environment variable:
+ *   - STATS_INTERVAL_SEC : jarak antar laporan (default: 60, 0 = nonaktif)
+ * 
+ * @param pipeline Pipeline ingest controller, atau null jika inline
+ * @return Reporter; harus dihancurkan SEBELUM controller pemilik pipeline
+ */
+std::unique_ptr<StatsReporter> start_stats_reporter(const IngestPipeline* pipeline) {
+    std::chrono::seconds interval(std::max(get_env_int("STATS_INTERVAL_SEC", 60), 0));
+    std::vector<StatsReporter::Report> reports;
+
+    if (pipeline) {
+        reports.push_back([pipeline] {
+            IngestPipelineStats s = pipeline->stats();
+            spdlog::info("[Stats] Ingest: queue={}/{}, enqueued={}, processed={}, dropped={}, rejected={}",
+                         s.queue_size, s.capacity, s.enqueued, s.processed, s.dropped, s.rejected);
+        });
+    }
+    if (g_bridge) {
+        reports.push_back([bridge = g_bridge] {
+            for (const auto& adapter : bridge->adapter_stats()) {
+                if (!adapter.queued) {
+                    spdlog::info("[Stats] Bridge[{}]: inline (no queue)", adapter.name);
+                    continue;
+                }
+                const BatchWorkerStats& s = adapter.queue;
+                spdlog::info("[Stats] Bridge[{}]: queue={}/{}, enqueued={}, processed={}, dropped={}, rejected={}",
+                             adapter.name, s.queue_size, s.capacity, s.enqueued, s.processed,
+                             s.dropped, s.rejected);
+            }
+        });
+    }
+
+    // Record log yang dibuang tidak terlihat di log itu sendiri; laporkan
+    // sebagai warn (tetap muncul pada LOG_LEVEL=warn) hanya saat bertambah
+    reports.push_back([last_dropped = size_t{0}]() mutable {
+        size_t dropped = utils::log_dropped_count();
+        if (dropped > last_dropped) {
+            spdlog::warn("[Stats] Logger: {} record(s) dropped since last report ({} total, async queue full)",
+                         dropped - last_dropped, dropped);
+            last_dropped = dropped;
+        }
+    });
+
+    if (interval.count() > 0) {
+        spdlog::info("[Stats] Reporting every {}s", interval.count());
+    }
+    return std::make_unique<StatsReporter>(interval, std::move(reports));
+}
+
 /**
  * Jalankan gRPC Server.
  * 
  * Fungsi ini:
- *   1. Membuat SensorController (yang berperan sebagai gRPC Service + Observable)
+ *   1. Membuat controller sesuai mode (sync: SensorController, async: AsyncSensorController)
  *   2. Mendaftarkan observer: SensorDataLogHandler dan SensorDataValidator
  *   3. Membangun dan menjalankan gRPC server
  * 
- * Server akan BLOCKING di server->Wait() -- artinya fungsi ini tidak return
- * sampai server di-shutdown. Karena itu, WebSocket server harus dijalankan
- * di thread terpisah SEBELUM memanggil fungsi ini.
+ * Server akan BLOCKING (server->Wait() atau service->run()) -- artinya fungsi
+ * ini tidak return sampai server di-shutdown. Karena itu, WebSocket server
+ * harus dijalankan di thread terpisah SEBELUM memanggil fungsi ini.
  * 
  * Environment variables yang digunakan:
- *   - GRPC_HOST : IP address binding (default: "0.0.0.0" = semua interface)
- *   - GRPC_PORT : Port number (default: 50051)
+ *   - GRPC_HOST       : IP address binding (default: "0.0.0.0" = semua interface)
+ *   - GRPC_PORT       : Port number (default: 50051)
+ *   - GRPC_MODE       : "sync" (default) atau "async" (Completion Queue)
+ *   - GRPC_CQ_THREADS : Jumlah thread Completion Queue untuk mode async
+ *                       (default: jumlah CPU core)
+ *   - INGEST_*        : Konfigurasi antrian ingest (lihat load_pipeline_config())
+ *   - STATS_*         : Laporan statistik berkala (lihat start_stats_reporter())
  */
 void run_grpc_server() {
     // Baca konfigurasi host dan port dari environment variable
     std::string host = get_env_string("GRPC_HOST", "0.0.0.0");
     int port = get_env_int("GRPC_PORT", 50051);
     std::string server_address = host + ":" + std::to_string(port);
+    std::string mode = get_env_string("GRPC_MODE", "sync");
+    IngestPipelineConfig pipeline_config = load_pipeline_config(mode == "async");
 
-    // Buat SensorController dengan referensi ke BridgeManager
-    // SensorController = gRPC Service + Observable (dual role)
-    auto service = std::make_shared<SensorController>(g_bridge);
+    grpc::ServerBuilder builder;
+    builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
 
-    // Buat concrete observers
-    auto log_handler = std::make_shared<SensorDataLogHandler>();  // Observer #1: logging
-    auto validator   = std::make_shared<SensorDataValidator>();   // Observer #2: validasi
+    if (mode == "async") {
+        // Mode async: sejumlah tetap thread Completion Queue melayani semua stream
+        int default_threads = static_cast<int>(std::thread::hardware_concurrency());
+        int cq_threads = get_env_int("GRPC_CQ_THREADS", default_threads > 0 ? default_threads : 1);
 
-    // Daftarkan observers ke SensorController (Observable)
-    // Setelah ini, setiap data sensor masuk akan otomatis di-log dan di-validasi
-    service->add_observer(log_handler);  
-    service->add_observer(validator);     
+        auto service = std::make_shared<AsyncSensorController>(g_bridge, cq_threads, pipeline_config);
+        register_observers(*service);
+        service->register_service(builder);  // RegisterService + AddCompletionQueue
 
-    spdlog::info("Observers: Registered {} handler(s) to SensorController", 2);
+        std::unique_ptr<grpc::Server> server(builder.BuildAndStart());
+        spdlog::info("[gRPC] Server active at {} (async)", server_address);
+        auto reporter = start_stats_reporter(service->pipeline());  // Dihancurkan sebelum service
+        service->run();  // Blocking: thread Completion Queue melayani request
+        return;
+    }
 
-    // Build gRPC server dengan konfigurasi
-    grpc::ServerBuilder builder;
-    builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
+    // Mode sync (default): gRPC menyediakan thread per RPC yang aktif
+    // SensorController = gRPC Service + Observable (dual role)
+    auto service = std::make_shared<SensorController>(g_bridge, pipeline_config);
+    register_observers(*service);
     builder.RegisterService(service.get());  // Daftarkan service ke gRPC
 
     // Start server (BLOCKING -- fungsi tidak return sampai server shutdown)
     std::unique_ptr<grpc::Server> server(builder.BuildAndStart());
     spdlog::info("[gRPC] Server active at {}", server_address);
+    auto reporter = start_stats_reporter(service->pipeline());  // Dihancurkan sebelum service
     server->Wait();  // Blocking: tunggu dan handle request sampai shutdown
 }
 
@@ -143,13 +348,64 @@ void run_grpc_server() {
  * WebSocket server bertugas menerima koneksi dari browser/client
  * dan mem-broadcast data sensor ke semua client yang terhubung.
  * 
+ * @param server Server yang dijalankan; thread ini ikut memilikinya, jadi
+ *               aman walaupun main() me-reset g_ws_server saat shutdown
+ * 
  * Environment variable:
- *   - WS_PORT : Port WebSocket server (default: 9002)
+ *   - WS_PORT    : Port WebSocket server (default: 9002)
+ *   - WS_BACKEND / WS_THREADS : dibaca di create_ws_server()
  */
-void run_ws_server() {
+void run_ws_server(std::shared_ptr<IWsServer> server) {
     int port = get_env_int("WS_PORT", 9002);
-    spdlog::info("[WebSocket] Server starting at port {}", port);
-    g_ws_server->run(static_cast<uint16_t>(port));  // Blocking di thread sendiri
+    spdlog::info("[WebSocket] Server starting at port {} ({})", port, server->backend_name());
+    server->run(static_cast<uint16_t>(port));  // Blocking di thread sendiri
+}
+
+/**
+ * Buat WebSocket server sesuai backend yang dipilih.
+ * 
+ * Environment variables:
+ *   - WS_BACKEND : "websocketpp" (default) atau "uws" (uWebSockets, pub/sub topic)
+ *   - WS_THREADS : jumlah thread event loop (default: 1)
+ *   - WS_MAX_BUFFERED_BYTES   : batas buffer kirim per client (default: 1048576)
+ *   - WS_SLOW_CONSUMER_POLICY : "drop_newest" (default), "conflate", atau "disconnect"
+ *   - WS_COMPRESSION           : "shared" = permessage-deflate sekali per pesan (websocketpp saja)
+ *   - WS_COMPRESSION_LEVEL     : level zlib 1-9 (default: 6)
+ *   - WS_COMPRESSION_MIN_BYTES : payload lebih kecil tidak dikompresi (default: 256)
+ *   - WS_SNAPSHOT_ON_CONNECT   : "on" (default) = client baru menerima nilai terakhir semua sensor
+ * 
+ * @return Instance IWsServer (belum dijalankan)
+ */
+std::shared_ptr<IWsServer> create_ws_server() {
+    std::string backend = get_env_string("WS_BACKEND", "websocketpp");
+    int threads = get_env_int("WS_THREADS", 1);
+    size_t thread_count = static_cast<size_t>(threads > 0 ? threads : 1);
+
+    SlowConsumerConfig slow_consumer;
+    int max_buffered = get_env_int("WS_MAX_BUFFERED_BYTES", 1024 * 1024);
+    if (max_buffered > 0) {
+        slow_consumer.max_buffered_bytes = static_cast<size_t>(max_buffered);
+    }
+    slow_consumer.policy = utils::parse_slow_consumer_policy(
+        get_env_string("WS_SLOW_CONSUMER_POLICY", "drop_newest"), SlowConsumerPolicy::DROP_NEWEST);
+
+    WsCompressionConfig compression;
+    compression.enabled = (get_env_string("WS_COMPRESSION", "off") == "shared");
+    compression.level = get_env_int("WS_COMPRESSION_LEVEL", 6);
+    compression.min_bytes = static_cast<size_t>(std::max(get_env_int("WS_COMPRESSION_MIN_BYTES", 256), 0));
+
+    bool snapshot_on_connect = (get_env_string("WS_SNAPSHOT_ON_CONNECT", "on") == "on");
+
+    if (backend == "uws" || backend == "uwebsockets") {
+        if (compression.enabled) {
+            spdlog::warn("[WebSocket] WS_COMPRESSION is only supported by the websocketpp backend, ignoring");
+        }
+        return std::make_shared<UwsServer>(thread_count, slow_consumer, snapshot_on_connect);
+    }
+    if (backend != "websocketpp") {
+        spdlog::warn("[WebSocket] Unknown WS_BACKEND '{}', using websocketpp", backend);
+    }
+    return std::make_shared<WsServer>(thread_count, slow_consumer, compression, snapshot_on_connect);
 }
 
 /**
@@ -163,17 +419,29 @@ void run_ws_server() {
  * Adapter yang didaftarkan:
  *   1. WebSocketAdapter -- kirim data ke browser/frontend via WebSocket
  *   2. DdsAdapter       -- kirim data ke DDS network via OpenDDS
+ * 
+ * Setiap adapter mendapat antrian + thread worker sendiri
+ * (lihat load_adapter_queue_config()).
  */
 void init_bridge() {
     g_bridge = std::make_shared<BridgeManager>();
     
     // Buat adapter dengan referensi ke server/publisher masing-masing
-    auto ws_adapter = std::make_shared<WebSocketAdapter>(g_ws_server);   // Adapter WebSocket
+    // WS_CONFLATE=on: kirim nilai terbaru per sensor setiap tick (WS_CONFLATE_HZ, default 20, maks. 1000)
+    WebSocketAdapterConfig ws_config;
+    ws_config.conflate = (get_env_string("WS_CONFLATE", "off") == "on");
+    ws_config.tick_hz = get_env_int("WS_CONFLATE_HZ", 20);
+    // WS_BATCH_MODE=on: satu frame JSON array per WS_BATCH_MAX data atau per WS_BATCH_LATENCY_MS
+    ws_config.batch = (get_env_string("WS_BATCH_MODE", "off") == "on");
+    ws_config.batch_max = static_cast<size_t>(std::max(get_env_int("WS_BATCH_MAX", 256), 1));
+    ws_config.batch_latency = std::chrono::milliseconds(std::max(get_env_int("WS_BATCH_LATENCY_MS", 10), 1));
+
+    auto ws_adapter = std::make_shared<WebSocketAdapter>(g_ws_server, ws_config);  // Adapter WebSocket
     auto dds_adapter = std::make_shared<DdsAdapter>(g_dds_pub);         // Adapter DDS
     
     // Daftarkan kedua adapter ke bridge
-    g_bridge->add_adapter(ws_adapter);
-    g_bridge->add_adapter(dds_adapter);
+    g_bridge->add_adapter(ws_adapter, load_adapter_queue_config("BRIDGE_WS"));
+    g_bridge->add_adapter(dds_adapter, load_adapter_queue_config("BRIDGE_DDS"));
     
     spdlog::info("Bridge: Initialized with {} adapters", 2);
 }
@@ -200,7 +468,7 @@ int main(int argc, char* argv[]) {
     utils::init_logger();
     
     // 2. Buat instance server (belum dijalankan, hanya alokasi objek)
-    g_ws_server = std::make_shared<WsServer>();
+    g_ws_server = create_ws_server();
     g_dds_pub = std::make_shared<DdsPublisher>();
     
     // 3. Susun argumen untuk DDS -- tambahkan flag -DCPSConfigFile
@@ -230,11 +498,17 @@ int main(int argc, char* argv[]) {
     
     // 6. Jalankan WebSocket server di thread terpisah
     //    detach() artinya thread berjalan independen, tidak perlu di-join
-    std::thread ws_thread(run_ws_server);
+    std::thread ws_thread(run_ws_server, g_ws_server);  // Thread ikut memiliki server
     ws_thread.detach();
 
     // 7. Jalankan gRPC server (BLOCKING -- program berhenti di sini sampai shutdown)
     run_grpc_server();
 
+    // Hancurkan komponen SEBELUM logger ditutup: destructor-nya masih menulis
+    // log (flush batch, statistik micro-batch, cleanup DDS)
+    g_bridge.reset();
+    g_dds_pub.reset();
+    g_ws_server.reset();
+    utils::shutdown_logger();  // Kosongkan antrian log async
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,550 @@
+/**
+ * async_sensor_controller.cpp -- Implementasi AsyncSensorController
+ *
+ * File ini berisi state machine untuk 5 jenis gRPC communication pattern
+ * di atas Completion Queue (async API):
+ *   1. SendSensorDataCall    (Unary)            : REQUEST -> FINISH
+ *   2. StreamSensorDataCall  (Client Streaming) : REQUEST -> READING* -> FINISH
+ *   3. MonitorSensorCall     (Server Streaming) : REQUEST -> (WRITING -> WAITING)* -> FINISH
+ *   4. InteractiveSensorCall (Bidirectional)    : REQUEST -> (READING -> WRITING)* -> FINISH
+ *   5. SendSensorBatchCall   (Batch Unary)      : REQUEST -> FINISH
+ *
+ * Cara kerja Completion Queue:
+ *   - Setiap operasi async (Request, Read, Write, Finish, Alarm) diberi "tag".
+ *     Di sini tag = pointer ke objek RpcCall itu sendiri.
+ *   - Saat operasi selesai, cq->Next() mengembalikan tag tersebut, lalu
+ *     thread polling memanggil proceed(ok) untuk memajukan state machine.
+ *   - Setiap RpcCall hanya punya SATU operasi yang pending pada satu waktu,
+ *     sehingga tidak perlu mutex di dalam objek call.
+ *
+ * Siklus hidup objek RpcCall:
+ *   - Dibuat dengan new, langsung mendaftar menunggu RPC berikutnya (RequestXxx)
+ *   - Saat RPC masuk, membuat objek baru untuk menunggu RPC selanjutnya
+ *   - Menghapus dirinya sendiri (delete this) setelah Finish selesai
+ */
+#include "async_sensor_controller.h"
+#include "adapters/service_adapters/bridge_manager.h"
+#include "convert_status.h"
+#include "utils/sensor_batch.h"
+#include <grpcpp/alarm.h>
+#include <spdlog/spdlog.h>
+#include <chrono>
+
+namespace {
+/**
+ * Waktu sekarang dalam epoch milliseconds (untuk processed_timestamp).
+ */
+int64_t now_ms() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+}  // namespace
+
+/**
+ * RpcCall -- Base class untuk semua state machine RPC.
+ *
+ * Menyimpan ServerContext dan Completion Queue milik call ini.
+ * proceed(ok) dipanggil oleh thread polling setiap kali operasi
+ * async yang pending selesai.
+ */
+class AsyncSensorController::RpcCall {
+public:
+    RpcCall(AsyncSensorController* owner, grpc::ServerCompletionQueue* cq)
+        : owner_(owner), cq_(cq) {
+    }
+    virtual ~RpcCall() = default;
+
+    /**
+     * Majukan state machine satu langkah.
+     * @param ok false jika operasi gagal (client disconnect, stream selesai,
+     *           atau Completion Queue sedang shutdown)
+     */
+    virtual void proceed(bool ok) = 0;
+
+protected:
+    AsyncSensorController* owner_;     // Controller pemilik (observer + bridge)
+    grpc::ServerCompletionQueue* cq_;  // Completion Queue tempat call ini berjalan
+    grpc::ServerContext ctx_;          // Konteks gRPC untuk call ini
+};
+
+/**
+ * Unary RPC -- SendSensorData.
+ * REQUEST: terima 1 data -> ingest -> Finish
+ * FINISH : hapus objek
+ */
+class AsyncSensorController::SendSensorDataCall final : public AsyncSensorController::RpcCall {
+public:
+    SendSensorDataCall(AsyncSensorController* owner, grpc::ServerCompletionQueue* cq)
+        : RpcCall(owner, cq), responder_(&ctx_) {
+        owner_->service_.RequestSendSensorData(&ctx_, &request_, &responder_, cq_, cq_, this);
+    }
+
+    void proceed(bool ok) override {
+        if (state_ == State::REQUEST) {
+            if (!ok) {          // Completion Queue shutdown -- tidak ada RPC masuk
+                delete this;
+                return;
+            }
+            new SendSensorDataCall(owner_, cq_);  // Siap menerima RPC berikutnya
+
+            spdlog::debug("Incoming gRPC -> Sensor ID: {}, Temp: {}C",
+                          request_.sensor_id(), request_.temperature());
+            state_ = State::FINISH;
+
+            grpc::Status status = owner_->ingest(request_);
+            if (!status.ok()) {
+                responder_.FinishWithError(status, this);
+                return;
+            }
+
+            response_.set_success(true);
+            response_.set_message("Bridge: Data processed successfully");
+            responder_.Finish(response_, grpc::Status::OK, this);
+            return;
+        }
+        delete this;  // FINISH selesai (ok atau tidak) -- call berakhir
+    }
+
+private:
+    enum class State { REQUEST, FINISH };
+    State state_ = State::REQUEST;
+    iot::SensorRequest request_;
+    iot::SensorResponse response_;
+    grpc::ServerAsyncResponseWriter<iot::SensorResponse> responder_;
+};
+
+/**
+ * Client Streaming RPC -- StreamSensorData.
+ * REQUEST: stream dibuka -> Read pertama
+ * READING: ok=true  -> ingest, Read berikutnya (antrian penuh -> Finish RESOURCE_EXHAUSTED)
+ *          ok=false -> client menutup stream, kirim ringkasan (Finish)
+ * FINISH : hapus objek
+ */
+class AsyncSensorController::StreamSensorDataCall final : public AsyncSensorController::RpcCall {
+public:
+    StreamSensorDataCall(AsyncSensorController* owner, grpc::ServerCompletionQueue* cq)
+        : RpcCall(owner, cq), reader_(&ctx_) {
+        owner_->service_.RequestStreamSensorData(&ctx_, &reader_, cq_, cq_, this);
+    }
+
+    void proceed(bool ok) override {
+        switch (state_) {
+        case State::REQUEST:
+            if (!ok) {
+                delete this;
+                return;
+            }
+            new StreamSensorDataCall(owner_, cq_);
+            state_ = State::READING;
+            reader_.Read(&request_, this);
+            return;
+
+        case State::READING:
+            if (ok) {
+                spdlog::debug("[Stream] Sensor ID: {}, Temp: {}C",
+                              request_.sensor_id(), request_.temperature());
+                grpc::Status status = owner_->ingest(request_);
+                if (!status.ok()) {
+                    state_ = State::FINISH;
+                    reader_.FinishWithError(status, this);
+                    return;
+                }
+                ++count_;
+                reader_.Read(&request_, this);
+                return;
+            }
+            // Client selesai mengirim -- kirim response rangkuman
+            response_.set_success(true);
+            response_.set_message("Bridge: Stream processed");
+            response_.set_processed_timestamp(now_ms());
+            spdlog::info("[Stream] Total messages received: {}", count_);
+            state_ = State::FINISH;
+            reader_.Finish(response_, grpc::Status::OK, this);
+            return;
+
+        case State::FINISH:
+            delete this;
+            return;
+        }
+    }
+
+private:
+    enum class State { REQUEST, READING, FINISH };
+    State state_ = State::REQUEST;
+    int count_ = 0;  // Jumlah message yang diterima
+    iot::SensorRequest request_;
+    iot::SensorResponse response_;
+    grpc::ServerAsyncReader<iot::SensorResponse, iot::SensorRequest> reader_;
+};
+
+/**
+ * Server Streaming RPC -- MonitorSensor.
+ * Mengirim 5 update dengan interval 1 detik, sama seperti versi sync.
+ * Bedanya, jeda 1 detik memakai grpc::Alarm (bukan sleep), sehingga
+ * thread Completion Queue tidak pernah diblok.
+ *
+ * REQUEST: kirim update #1 (WRITING)
+ * WRITING: ok=true  -> jika sudah 5 update, Finish; jika belum, pasang Alarm (WAITING)
+ *          ok=false -> client disconnect, Finish dengan CANCELLED
+ * WAITING: Alarm berbunyi -> kirim update berikutnya (WRITING)
+ * FINISH : hapus objek
+ */
+class AsyncSensorController::MonitorSensorCall final : public AsyncSensorController::RpcCall {
+public:
+    MonitorSensorCall(AsyncSensorController* owner, grpc::ServerCompletionQueue* cq)
+        : RpcCall(owner, cq), writer_(&ctx_) {
+        owner_->service_.RequestMonitorSensor(&ctx_, &request_, &writer_, cq_, cq_, this);
+    }
+
+    void proceed(bool ok) override {
+        switch (state_) {
+        case State::REQUEST:
+            if (!ok) {
+                delete this;
+                return;
+            }
+            new MonitorSensorCall(owner_, cq_);
+            spdlog::info("[Monitor] Starting stream for Sensor ID: {}", request_.sensor_id());
+            write_update();
+            return;
+
+        case State::WRITING:
+            if (!ok) {
+                finish(grpc::Status::CANCELLED);  // Client membatalkan request
+                return;
+            }
+            spdlog::info("[Monitor] Sent update #{} to client", sent_);
+            if (sent_ >= kTotalUpdates) {
+                finish(grpc::Status::OK);
+                return;
+            }
+            // Tunggu 1 detik tanpa memblok thread Completion Queue
+            state_ = State::WAITING;
+            alarm_.Set(cq_, std::chrono::system_clock::now() + std::chrono::seconds(1), this);
+            return;
+
+        case State::WAITING:
+            if (!ok) {
+                finish(grpc::Status::CANCELLED);  // Alarm dibatalkan (shutdown)
+                return;
+            }
+            write_update();
+            return;
+
+        case State::FINISH:
+            delete this;
+            return;
+        }
+    }
+
+private:
+    static constexpr int kTotalUpdates = 5;  // Jumlah update per stream
+
+    void write_update() {
+        ++sent_;
+        response_.Clear();
+        response_.set_success(true);
+        response_.set_message("Real-time update #" + std::to_string(sent_));
+        response_.set_processed_timestamp(now_ms());
+        state_ = State::WRITING;
+        writer_.Write(response_, this);
+    }
+
+    void finish(const grpc::Status& status) {
+        state_ = State::FINISH;
+        writer_.Finish(status, this);
+    }
+
+    enum class State { REQUEST, WRITING, WAITING, FINISH };
+    State state_ = State::REQUEST;
+    int sent_ = 0;  // Jumlah update yang sudah dikirim
+    iot::SensorRequest request_;
+    iot::SensorResponse response_;
+    grpc::ServerAsyncWriter<iot::SensorResponse> writer_;
+    grpc::Alarm alarm_;
+};
+
+/**
+ * Bidirectional Streaming RPC -- InteractiveSensor.
+ * Sama seperti versi sync: baca 1 request, ingest, balas 1 echo, ulangi.
+ *
+ * REQUEST: stream dibuka -> Read pertama
+ * READING: ok=true  -> ingest, Write echo (WRITING) (antrian penuh -> Finish RESOURCE_EXHAUSTED)
+ *          ok=false -> client menutup stream, Finish OK
+ * WRITING: ok=true  -> Read berikutnya
+ *          ok=false -> client disconnect, Finish CANCELLED
+ * FINISH : hapus objek
+ */
+class AsyncSensorController::InteractiveSensorCall final : public AsyncSensorController::RpcCall {
+public:
+    InteractiveSensorCall(AsyncSensorController* owner, grpc::ServerCompletionQueue* cq)
+        : RpcCall(owner, cq), stream_(&ctx_) {
+        owner_->service_.RequestInteractiveSensor(&ctx_, &stream_, cq_, cq_, this);
+    }
+
+    void proceed(bool ok) override {
+        switch (state_) {
+        case State::REQUEST:
+            if (!ok) {
+                delete this;
+                return;
+            }
+            new InteractiveSensorCall(owner_, cq_);
+            spdlog::info("[Interactive] Session started");
+            state_ = State::READING;
+            stream_.Read(&request_, this);
+            return;
+
+        case State::READING:
+            if (!ok) {
+                spdlog::info("[Interactive] Session closed by client");
+                finish(grpc::Status::OK);
+                return;
+            }
+            spdlog::debug("[Interactive] Received Sensor ID: {} from {}",
+                          request_.sensor_id(), request_.location());
+
+            response_.Clear();
+            response_.set_success(true);
+            response_.set_message("Server Echo: Received data from " + request_.location());
+            response_.set_processed_timestamp(now_ms());
+
+            {
+                grpc::Status status = owner_->ingest(request_);
+                if (!status.ok()) {
+                    finish(status);
+                    return;
+                }
+            }
+            state_ = State::WRITING;
+            stream_.Write(response_, this);
+            return;
+
+        case State::WRITING:
+            if (!ok) {
+                finish(grpc::Status::CANCELLED);
+                return;
+            }
+            state_ = State::READING;
+            stream_.Read(&request_, this);
+            return;
+
+        case State::FINISH:
+            delete this;
+            return;
+        }
+    }
+
+private:
+    void finish(const grpc::Status& status) {
+        state_ = State::FINISH;
+        stream_.Finish(status, this);
+    }
+
+    enum class State { REQUEST, READING, WRITING, FINISH };
+    State state_ = State::REQUEST;
+    iot::SensorRequest request_;
+    iot::SensorResponse response_;
+    grpc::ServerAsyncReaderWriter<iot::SensorResponse, iot::SensorRequest> stream_;
+};
+
+/**
+ * Batch Unary RPC -- SendSensorBatch.
+ * REQUEST: terima 1 SensorBatch -> decode -> ingest_batch -> Finish
+ *          (batch tidak valid -> Finish dengan INVALID_ARGUMENT)
+ * FINISH : hapus objek
+ */
+class AsyncSensorController::SendSensorBatchCall final : public AsyncSensorController::RpcCall {
+public:
+    SendSensorBatchCall(AsyncSensorController* owner, grpc::ServerCompletionQueue* cq)
+        : RpcCall(owner, cq), responder_(&ctx_) {
+        owner_->service_.RequestSendSensorBatch(&ctx_, &batch_, &responder_, cq_, cq_, this);
+    }
+
+    void proceed(bool ok) override {
+        if (state_ == State::REQUEST) {
+            if (!ok) {
+                delete this;
+                return;
+            }
+            new SendSensorBatchCall(owner_, cq_);
+            state_ = State::FINISH;
+
+            std::vector<SensorSample> readings;
+            std::string error;
+            utils::ConvertStatus decoded = utils::decode_sensor_batch(batch_, readings, error);
+            if (decoded != utils::ConvertStatus::OK) {
+                spdlog::warn("[Batch] Rejected: {}", error);
+                responder_.FinishWithError(to_grpc_status(decoded, error), this);
+                return;
+            }
+
+            spdlog::info("[Batch] Received {} reading(s)", readings.size());
+            grpc::Status status = owner_->ingest_batch(readings);
+            if (!status.ok()) {
+                responder_.FinishWithError(status, this);
+                return;
+            }
+
+            response_.set_success(true);
+            response_.set_message("Bridge: Batch processed (" + std::to_string(readings.size()) + " readings)");
+            response_.set_processed_timestamp(now_ms());
+            responder_.Finish(response_, grpc::Status::OK, this);
+            return;
+        }
+        delete this;
+    }
+
+private:
+    enum class State { REQUEST, FINISH };
+    State state_ = State::REQUEST;
+    iot::SensorBatch batch_;
+    iot::SensorResponse response_;
+    grpc::ServerAsyncResponseWriter<iot::SensorResponse> responder_;
+};
+
+/**
+ * Constructor: simpan bridge, jumlah thread Completion Queue, dan siapkan
+ * IngestPipeline. Nilai cq_threads < 1 dipaksa menjadi 1.
+ */
+AsyncSensorController::AsyncSensorController(std::shared_ptr<BridgeManager> bridge, int cq_threads,
+                                             const IngestPipelineConfig& pipeline_config)
+    : bridge_(bridge),
+      cq_threads_(cq_threads > 0 ? cq_threads : 1) {
+    if (pipeline_config.enabled) {
+        pipeline_ = std::make_unique<IngestPipeline>(*this, bridge_, pipeline_config);
+    }
+}
+
+/**
+ * Destructor: pastikan Completion Queue di-shutdown dan thread di-join
+ * sebelum service_ dan cqs_ dihancurkan.
+ */
+AsyncSensorController::~AsyncSensorController() {
+    shutdown();
+    for (auto& t : threads_) {
+        if (t.joinable()) {
+            t.join();
+        }
+    }
+}
+
+/**
+ * Daftarkan AsyncService ke builder dan minta satu Completion Queue
+ * untuk setiap thread polling.
+ */
+void AsyncSensorController::register_service(grpc::ServerBuilder& builder) {
+    builder.RegisterService(&service_);
+    for (int i = 0; i < cq_threads_; ++i) {
+        cqs_.push_back(builder.AddCompletionQueue());
+    }
+}
+
+/**
+ * Siapkan handler awal untuk setiap RPC di setiap Completion Queue,
+ * lalu jalankan thread polling dan tunggu sampai semuanya selesai.
+ */
+void AsyncSensorController::run() {
+    for (auto& cq : cqs_) {
+        // Objek-objek ini menghapus dirinya sendiri (lihat RpcCall)
+        new SendSensorDataCall(this, cq.get());
+        new StreamSensorDataCall(this, cq.get());
+        new MonitorSensorCall(this, cq.get());
+        new InteractiveSensorCall(this, cq.get());
+        new SendSensorBatchCall(this, cq.get());
+    }
+
+    for (auto& cq : cqs_) {
+        threads_.emplace_back(&AsyncSensorController::poll, this, cq.get());
+    }
+    spdlog::info("[gRPC] Async mode: {} completion queue thread(s)", cq_threads_);
+
+    for (auto& t : threads_) {
+        t.join();
+    }
+    threads_.clear();
+}
+
+/**
+ * Shutdown semua Completion Queue.
+ * Setelah ini cq->Next() mengembalikan sisa event dengan ok=false,
+ * lalu return false sehingga thread polling berhenti.
+ */
+void AsyncSensorController::shutdown() {
+    if (shutdown_.exchange(true)) {
+        return;  // Sudah pernah di-shutdown
+    }
+    for (auto& cq : cqs_) {
+        cq->Shutdown();
+    }
+}
+
+/**
+ * Loop polling: ambil event selesai dari Completion Queue dan majukan
+ * state machine RpcCall yang bersangkutan.
+ */
+void AsyncSensorController::poll(grpc::ServerCompletionQueue* cq) {
+    void* tag = nullptr;
+    bool ok = false;
+    while (cq->Next(&tag, &ok)) {
+        static_cast<RpcCall*>(tag)->proceed(ok);
+    }
+}
+
+/**
+ * Konversi SensorRequest ke SensorSample (tepi sistem) lalu ingest().
+ * @return INVALID_ARGUMENT jika string terlalu panjang, RESOURCE_EXHAUSTED
+ *         jika tabel string penuh atau antrian penuh (policy REJECT)
+ */
+grpc::Status AsyncSensorController::ingest(const iot::SensorRequest& request) {
+    SensorSample sample;
+    std::string error;
+    utils::ConvertStatus converted = utils::to_sample(request, sample, error);
+    if (converted != utils::ConvertStatus::OK) {
+        spdlog::warn("[Ingest] Rejected sensor {}: {}", request.sensor_id(), error);
+        return to_grpc_status(converted, error);
+    }
+    return ingest(sample);
+}
+
+/**
+ * Proses satu data sensor -- semantik sama dengan SensorController::ingest():
+ *   a. Observer Pattern : notify_observers() -> log, validasi, dll
+ *   b. Bridge Pattern   : bridge_->broadcast_sensor_data() -> WebSocket, DDS
+ * Jika pipeline aktif, keduanya dijalankan thread dispatcher.
+ */
+grpc::Status AsyncSensorController::ingest(const SensorSample& sample) {
+    if (pipeline_) {
+        if (!pipeline_->submit(sample)) {
+            return grpc::Status(grpc::StatusCode::RESOURCE_EXHAUSTED, "Bridge: Ingest queue full");
+        }
+        return grpc::Status::OK;
+    }
+
+    notify_observers(sample);
+
+    if (bridge_) {
+        bridge_->broadcast_sensor_data(sample);
+    }
+    return grpc::Status::OK;
+}
+
+/**
+ * Proses satu batch data sensor sebagai satu unit -- semantik sama dengan
+ * SensorController::SendSensorBatch().
+ */
+grpc::Status AsyncSensorController::ingest_batch(absl::Span<const SensorSample> batch) {
+    if (pipeline_) {
+        if (!pipeline_->submit_batch(batch)) {
+            return grpc::Status(grpc::StatusCode::RESOURCE_EXHAUSTED, "Bridge: Ingest queue full");
+        }
+        return grpc::Status::OK;
+    }
+
+    notify_observers_batch(batch);
+
+    if (bridge_) {
+        bridge_->broadcast_sensor_batch(batch);
+    }
+    return grpc::Status::OK;
+}
@@ -0,0 +1,142 @@
+/**
+ * async_sensor_controller.h -- Definisi class AsyncSensorController
+ *
+ * File ini mendefinisikan AsyncSensorController, versi asynchronous dari
+ * SensorController. Semua RPC (SendSensorData, StreamSensorData, MonitorSensor,
+ * InteractiveSensor, SendSensorBatch) dijalankan sebagai state machine di atas
+ * gRPC Completion Queue, sehingga stream yang terbuka lama TIDAK memakan
+ * satu thread per stream seperti pada sync server.
+ *
+ * Mode ini dipilih saat startup via environment variable GRPC_MODE=async
+ * (lihat run_grpc_server() di app.cpp).
+ */
+#pragma once
+#include "sensor.grpc.pb.h"
+#include "adapters/abstract_adapters/observable/observable.h"
+#include "pipeline/ingest_pipeline.h"
+#include <grpcpp/grpcpp.h>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// Forward declaration -- header ini hanya memakai shared_ptr ke BridgeManager
+class BridgeManager;
+
+/**
+ * AsyncSensorController -- gRPC Async Service + Observable
+ *
+ * Perbedaan dengan SensorController (sync):
+ *   - Sync  : gRPC menyediakan 1 thread per RPC yang aktif. Stream panjang
+ *             (StreamSensorData, InteractiveSensor, MonitorSensor) mengunci
+ *             thread tersebut sampai stream selesai.
+ *   - Async : sejumlah TETAP thread (GRPC_CQ_THREADS) mem-poll Completion Queue.
+ *             Setiap RPC adalah objek kecil (RpcCall) yang maju satu langkah
+ *             setiap kali operasi I/O-nya selesai. Ribuan stream bisa dilayani
+ *             oleh beberapa thread saja.
+ *
+ * Semantik observer + bridge SAMA dengan SensorController:
+ *   setiap data sensor yang diterima -> notify_observers() -> bridge broadcast
+ *
+ * Cara pakai (lihat app.cpp):
+ *   auto service = std::make_shared<AsyncSensorController>(bridge, 4);
+ *   service->add_observer(...);
+ *   service->register_service(builder);        // RegisterService + AddCompletionQueue
+ *   auto server = builder.BuildAndStart();
+ *   service->run();                            // BLOCKING sampai shutdown()
+ */
+class AsyncSensorController final : public Observable {
+public:
+    /**
+     * Constructor.
+     * @param bridge          BridgeManager untuk broadcast data (boleh null)
+     * @param cq_threads      Jumlah thread Completion Queue (minimal 1)
+     * @param pipeline_config Konfigurasi antrian; enabled=false berarti proses inline
+     */
+    AsyncSensorController(std::shared_ptr<BridgeManager> bridge, int cq_threads,
+                          const IngestPipelineConfig& pipeline_config = IngestPipelineConfig());
+
+    /**
+     * Destructor: shutdown Completion Queue dan join semua thread.
+     */
+    ~AsyncSensorController();
+
+    /**
+     * Daftarkan async service dan buat satu Completion Queue per thread.
+     * Harus dipanggil SEBELUM builder.BuildAndStart().
+     * @param builder ServerBuilder yang akan membangun gRPC server
+     */
+    void register_service(grpc::ServerBuilder& builder);
+
+    /**
+     * Mulai melayani RPC: siapkan handler awal untuk setiap RPC di setiap
+     * Completion Queue, lalu jalankan thread-thread polling.
+     * BLOCKING -- return setelah shutdown() dipanggil dan semua thread selesai.
+     * Harus dipanggil SETELAH builder.BuildAndStart().
+     */
+    void run();
+
+    /**
+     * Hentikan semua Completion Queue. Panggil setelah grpc::Server::Shutdown().
+     */
+    void shutdown();
+
+    /**
+     * Pipeline ingest (untuk statistik), atau null jika data diproses inline.
+     */
+    const IngestPipeline* pipeline() const { return pipeline_.get(); }
+
+private:
+    // State machine per jenis RPC -- didefinisikan di async_sensor_controller.cpp.
+    // Nested class agar bisa mengakses ingest() dan service_ (private).
+    class RpcCall;
+    class SendSensorDataCall;
+    class StreamSensorDataCall;
+    class MonitorSensorCall;
+    class InteractiveSensorCall;
+    class SendSensorBatchCall;
+
+    /**
+     * Proses satu data sensor: notify observers lalu broadcast ke bridge
+     * (via pipeline jika aktif). Dipanggil dari thread Completion Queue.
+     * @return RESOURCE_EXHAUSTED jika antrian penuh dengan policy REJECT
+     */
+    grpc::Status ingest(const SensorSample& sample);
+
+    /**
+     * Konversi SensorRequest ke SensorSample lalu ingest(sample).
+     * @return INVALID_ARGUMENT / RESOURCE_EXHAUSTED jika string tidak bisa di-intern
+     */
+    grpc::Status ingest(const iot::SensorRequest& request);
+
+    /**
+     * Proses satu batch data sensor sebagai satu unit:
+     * notify_observers_batch() lalu broadcast_sensor_batch().
+     * @return RESOURCE_EXHAUSTED jika antrian penuh dengan policy REJECT
+     */
+    grpc::Status ingest_batch(absl::Span<const SensorSample> batch);
+
+    /**
+     * Loop polling satu Completion Queue (dijalankan oleh setiap thread).
+     */
+    void poll(grpc::ServerCompletionQueue* cq);
+
+    // Pointer ke BridgeManager -- sama seperti pada SensorController
+    std::shared_ptr<BridgeManager> bridge_;
+
+    // Async service hasil generate grpc_cpp_plugin (RequestXxx methods)
+    iot::SensorService::AsyncService service_;
+
+    // Satu Completion Queue per thread (menghindari contention antar thread)
+    std::vector<std::unique_ptr<grpc::ServerCompletionQueue>> cqs_;
+
+    // Thread-thread yang mem-poll Completion Queue
+    std::vector<std::thread> threads_;
+
+    int cq_threads_;                     // Jumlah thread/Completion Queue
+    std::atomic<bool> shutdown_{false};  // Cegah shutdown ganda
+
+    // Antrian + dispatcher antara thread Completion Queue dan observer/bridge.
+    // nullptr jika pipeline dinonaktifkan (proses inline).
+    std::unique_ptr<IngestPipeline> pipeline_;
+};
@@ -0,0 +1,25 @@
+#pragma once
+#include "pipeline/sensor_sample.h"
+#include <grpcpp/grpcpp.h>
+#include <string>
+
+/**
+ * convert_status.h -- Pemetaan utils::ConvertStatus ke grpc::Status
+ *
+ * Dipakai SensorController dan AsyncSensorController agar kegagalan
+ * konversi input (to_sample / decode_sensor_batch) dilaporkan ke client
+ * dengan kode yang sama:
+ *   INVALID   -> INVALID_ARGUMENT   (request salah, jangan diulang apa adanya)
+ *   EXHAUSTED -> RESOURCE_EXHAUSTED (kapasitas server habis)
+ */
+inline grpc::Status to_grpc_status(utils::ConvertStatus status, const std::string& error) {
+    switch (status) {
+        case utils::ConvertStatus::OK:
+            return grpc::Status::OK;
+        case utils::ConvertStatus::EXHAUSTED:
+            return grpc::Status(grpc::StatusCode::RESOURCE_EXHAUSTED, error);
+        case utils::ConvertStatus::INVALID:
+            break;
+    }
+    return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, error);
+}
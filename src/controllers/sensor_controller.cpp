@@ -1,33 +1,114 @@
 /**
  * sensor_controller.cpp -- Implementasi SensorController
  * 
- * File ini berisi implementasi 4 jenis gRPC communication pattern:
+ * File ini berisi implementasi 5 jenis gRPC communication pattern:
  *   1. Unary RPC          (SendSensorData)    : client kirim 1, server balas 1
  *   2. Client Streaming   (StreamSensorData)  : client kirim banyak, server balas 1
  *   3. Server Streaming   (MonitorSensor)      : client kirim 1, server balas banyak
  *   4. Bidirectional      (InteractiveSensor)  : client dan server saling kirim
+ *   5. Batch Unary        (SendSensorBatch)    : client kirim 1 batch kolom, server balas 1
  * 
  * Setiap method yang menerima data sensor menjalankan dua aksi:
  *   a. Observer Pattern  : notify_observers() -> log, validasi, dll
  *   b. Bridge Pattern    : bridge_->broadcast_sensor_data() -> WebSocket, DDS
  * 
+ * Jika IngestPipeline aktif (default), kedua aksi di atas dijalankan oleh
+ * thread dispatcher -- handler hanya memasukkan data ke antrian (ingest())
+ * lalu langsung membalas client.
+ * 
+ * Di sini adalah TEPI sistem: SensorRequest/SensorBatch (protobuf)
+ * dikonversi ke SensorSample (utils::to_sample) sebelum masuk pipeline.
+ * 
  * Pemisahan ini membuat SensorController tetap "tipis" (thin controller).
  * Logic logging, validasi, dan transport ada di class lain.
  */
 #include "sensor_controller.h"
 #include "adapters/service_adapters/bridge_manager.h"
+#include "convert_status.h"
+#include "utils/sensor_batch.h"
 #include <spdlog/spdlog.h>
 #include <chrono>
 #include <thread>
 
 /**
- * Constructor: simpan referensi ke BridgeManager.
+ * Constructor: simpan referensi ke BridgeManager dan siapkan IngestPipeline.
  * BridgeManager digunakan untuk broadcast data ke semua transport adapter.
  * 
- * @param bridge Shared pointer ke BridgeManager (bisa null jika bridge belum siap)
+ * @param bridge          Shared pointer ke BridgeManager (bisa null jika bridge belum siap)
+ * @param pipeline_config Konfigurasi antrian; enabled=false berarti proses inline
  */
-SensorController::SensorController(std::shared_ptr<BridgeManager> bridge)
+SensorController::SensorController(std::shared_ptr<BridgeManager> bridge,
+                                   const IngestPipelineConfig& pipeline_config)
     : bridge_(bridge) {
+    if (pipeline_config.enabled) {
+        pipeline_ = std::make_unique<IngestPipeline>(*this, bridge_, pipeline_config);
+    }
+}
+
+/**
+ * Konversi SensorRequest ke SensorSample (tepi sistem) lalu ingest().
+ * @return INVALID_ARGUMENT jika string terlalu panjang, RESOURCE_EXHAUSTED
+ *         jika tabel string penuh atau antrian penuh (policy REJECT)
+ */
+grpc::Status SensorController::ingest(const iot::SensorRequest& request) {
+    SensorSample sample;
+    std::string error;
+    utils::ConvertStatus converted = utils::to_sample(request, sample, error);
+    if (converted != utils::ConvertStatus::OK) {
+        spdlog::warn("[Ingest] Rejected sensor {}: {}", request.sensor_id(), error);
+        return to_grpc_status(converted, error);
+    }
+    return ingest(sample);
+}
+
+/**
+ * Teruskan satu data sensor ke observer dan bridge.
+ * 
+ * - Pipeline aktif  : masukkan ke antrian, dispatcher yang memproses
+ * - Pipeline nonaktif: proses langsung (inline) di thread gRPC
+ * 
+ * @param sample Data sensor (sudah dikonversi dari protobuf)
+ * @return Status::OK, atau RESOURCE_EXHAUSTED jika antrian penuh (policy REJECT)
+ */
+grpc::Status SensorController::ingest(const SensorSample& sample) {
+    if (pipeline_) {
+        if (!pipeline_->submit(sample)) {
+            return grpc::Status(grpc::StatusCode::RESOURCE_EXHAUSTED, "Bridge: Ingest queue full");
+        }
+        return grpc::Status::OK;
+    }
+
+    // OBSERVER PATTERN: Notify semua observer (LogHandler, Validator, dll)
+    // Observer bereaksi SEBELUM data dikirim ke transport adapters.
+    // Ini memungkinkan validasi/logging tanpa mengubah code di sini.
+    notify_observers(sample);
+
+    // BRIDGE PATTERN: Broadcast ke semua transport adapters (WebSocket, DDS)
+    if (bridge_) {
+        bridge_->broadcast_sensor_data(sample);
+    }
+    return grpc::Status::OK;
+}
+
+/**
+ * Teruskan satu batch data sensor ke observer dan bridge sebagai satu unit.
+ * 
+ * @param batch Kumpulan data sensor
+ * @return Status::OK, atau RESOURCE_EXHAUSTED jika antrian penuh (policy REJECT)
+ */
+grpc::Status SensorController::ingest_batch(absl::Span<const SensorSample> batch) {
+    if (pipeline_) {
+        if (!pipeline_->submit_batch(batch)) {
+            return grpc::Status(grpc::StatusCode::RESOURCE_EXHAUSTED, "Bridge: Ingest queue full");
+        }
+        return grpc::Status::OK;
+    }
+
+    notify_observers_batch(batch);
+    if (bridge_) {
+        bridge_->broadcast_sensor_batch(batch);
+    }
+    return grpc::Status::OK;
 }
 
 /**
@@ -39,29 +120,24 @@ SensorController::SensorController(std::shared_ptr<BridgeManager> bridge)
  * Alur:
  *   1. Client mengirim SensorRequest (1 data sensor)
  *   2. Server menerima request
- *   3. notify_observers() -> semua observer bereaksi (log, validasi)
- *   4. bridge_->broadcast() -> kirim ke WebSocket + DDS
- *   5. Server mengirim SensorResponse (success/fail)
+ *   3. ingest() -> notify_observers() + bridge_->broadcast() (via pipeline)
+ *   4. Server mengirim SensorResponse (success/fail)
  * 
  * @param context  Konteks gRPC (metadata, deadline, cancellation)
  * @param request  Data sensor dari client (protobuf)
  * @param response Response yang akan dikirim balik ke client
- * @return Status::OK jika berhasil
+ * @return Status::OK jika berhasil, RESOURCE_EXHAUSTED jika antrian penuh
  */
 grpc::Status SensorController::SendSensorData(grpc::ServerContext* context, 
                                              const iot::SensorRequest* request, 
                                              iot::SensorResponse* response) {
-    spdlog::info("Incoming gRPC -> Sensor ID: {}, Temp: {}C", 
-                 request->sensor_id(), request->temperature());
-    
-    // OBSERVER PATTERN: Notify semua observer (LogHandler, Validator, dll)
-    // Observer bereaksi SEBELUM data dikirim ke transport adapters.
-    // Ini memungkinkan validasi/logging tanpa mengubah code di sini.
-    notify_observers(*request);
+    spdlog::debug("Incoming gRPC -> Sensor ID: {}, Temp: {}C", 
+                  request->sensor_id(), request->temperature());
     
-    // BRIDGE PATTERN: Broadcast ke semua transport adapters (WebSocket, DDS)
-    if (bridge_) {
-        bridge_->broadcast_sensor_data(*request);
+    // OBSERVER + BRIDGE (lihat ingest()) -- dikonversi ke SensorSample di tepi
+    grpc::Status status = ingest(*request);
+    if (!status.ok()) {
+        return status;
     }
     
     // Kirim response sukses ke client
@@ -88,7 +164,7 @@ grpc::Status SensorController::SendSensorData(grpc::ServerContext* context,
  * @param context  Konteks gRPC
  * @param reader   Stream reader untuk membaca request dari client
  * @param response Response tunggal yang dikirim setelah semua data dibaca
- * @return Status::OK jika berhasil
+ * @return Status::OK jika berhasil, RESOURCE_EXHAUSTED jika antrian penuh
  */
 grpc::Status SensorController::StreamSensorData(
     grpc::ServerContext* context,
@@ -102,14 +178,13 @@ grpc::Status SensorController::StreamSensorData(
     // Baca request satu per satu dari stream client
     // Loop berhenti saat client menutup stream (reader->Read() return false)
     while (reader->Read(&request)) {
-        spdlog::info("[Stream] Sensor ID: {}, Temp: {}C", request.sensor_id(), request.temperature());
-
-        // OBSERVER: Notify untuk setiap message dalam stream
-        notify_observers(request);
+        spdlog::debug("[Stream] Sensor ID: {}, Temp: {}C", request.sensor_id(), request.temperature());
 
-        // BRIDGE: Broadcast ke adapters
-        if (bridge_) {
-            bridge_->broadcast_sensor_data(request);
+        // OBSERVER + BRIDGE untuk setiap message dalam stream.
+        // Objek request dipakai ulang oleh Read() berikutnya (tanpa alokasi baru).
+        grpc::Status status = ingest(request);
+        if (!status.ok()) {
+            return status;
         }
         ++count;
     }
@@ -197,7 +272,7 @@ grpc::Status SensorController::MonitorSensor(
  * 
  * @param context  Konteks gRPC
  * @param stream   Bidirectional stream (bisa read DAN write)
- * @return Status::OK setelah client menutup stream
+ * @return Status::OK setelah client menutup stream, RESOURCE_EXHAUSTED jika antrian penuh
  */
 grpc::Status SensorController::InteractiveSensor(
     grpc::ServerContext* context,
@@ -209,14 +284,12 @@ grpc::Status SensorController::InteractiveSensor(
     // Baca request satu per satu dari client
     // Untuk setiap request, langsung kirim response balik
     while (stream->Read(&request)) {
-        spdlog::info("[Interactive] Received Sensor ID: {} from {}", request.sensor_id(), request.location());
+        spdlog::debug("[Interactive] Received Sensor ID: {} from {}", request.sensor_id(), request.location());
 
-        // OBSERVER: Notify untuk setiap message dalam bidirectional stream
-        notify_observers(request);
-
-        // BRIDGE: Broadcast ke adapters
-        if (bridge_) {
-            bridge_->broadcast_sensor_data(request);
+        // OBSERVER + BRIDGE untuk setiap message dalam bidirectional stream
+        grpc::Status status = ingest(request);
+        if (!status.ok()) {
+            return status;
         }
 
         // Buat dan kirim response echo untuk setiap request yang diterima
@@ -233,3 +306,50 @@ grpc::Status SensorController::InteractiveSensor(
     spdlog::info("[Interactive] Session closed by client");
     return grpc::Status::OK;
 }
+
+/**
+ * Batch Unary RPC -- Client kirim 1 SensorBatch, server balas 1 response.
+ * 
+ * Gateway dengan ratusan sensor cukup mengirim SATU message berisi semua
+ * data dalam format kolom. Dibanding N x SendSensorData, ini menghemat
+ * framing, parsing, dan dispatch observer/bridge per data.
+ * 
+ * Alur:
+ *   1. Decode SensorBatch (kolom) -> vector<SensorSample> (baris)
+ *   2. ingest_batch() -> seluruh batch ke observer dan bridge sebagai satu unit
+ *   3. Kirim SensorResponse (jumlah data yang diproses)
+ * 
+ * @param context  Konteks gRPC
+ * @param batch    Batch data sensor dari client (format kolom)
+ * @param response Response yang akan dikirim balik ke client
+ * @return Status::OK jika berhasil, INVALID_ARGUMENT jika batch tidak valid,
+ *         RESOURCE_EXHAUSTED jika antrian penuh
+ */
+grpc::Status SensorController::SendSensorBatch(grpc::ServerContext* context,
+                                               const iot::SensorBatch* batch,
+                                               iot::SensorResponse* response) {
+    (void)context;  // Suppress unused parameter warning
+
+    std::vector<SensorSample> readings;
+    std::string error;
+    utils::ConvertStatus decoded = utils::decode_sensor_batch(*batch, readings, error);
+    if (decoded != utils::ConvertStatus::OK) {
+        spdlog::warn("[Batch] Rejected: {}", error);
+        return to_grpc_status(decoded, error);
+    }
+
+    spdlog::info("[Batch] Received {} reading(s)", readings.size());
+
+    // OBSERVER + BRIDGE: seluruh batch sebagai satu unit
+    grpc::Status status = ingest_batch(readings);
+    if (!status.ok()) {
+        return status;
+    }
+
+    response->set_success(true);
+    response->set_message("Bridge: Batch processed (" + std::to_string(readings.size()) + " readings)");
+    response->set_processed_timestamp(
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count());
+    return grpc::Status::OK;
+}
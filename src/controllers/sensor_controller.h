@@ -9,6 +9,7 @@
 #pragma once
 #include "sensor.grpc.pb.h"
 #include "adapters/abstract_adapters/observable/observable.h"
+#include "pipeline/ingest_pipeline.h"
 #include <grpcpp/grpcpp.h>
 #include <spdlog/spdlog.h>
 #include <thread>
@@ -29,8 +30,9 @@ class BridgeManager;
  * Alur data:
  *   gRPC Request masuk
  *       -> SensorController menerima
- *           -> notify_observers(request)    <-- Observer Pattern (log, validate, dll)
- *           -> bridge_->broadcast(request)  <-- Bridge Pattern (WebSocket, DDS)
+ *           -> ingest(request)              <-- masuk IngestPipeline (antrian)
+ *               -> notify_observers(request)    <-- Observer Pattern (log, validate, dll)
+ *               -> bridge_->broadcast(request)  <-- Bridge Pattern (WebSocket, DDS)
  *
  * Dengan ini, SensorController TIDAK perlu tahu:
  *   - Berapa banyak observer yang terdaftar
@@ -40,8 +42,10 @@ class BridgeManager;
 class SensorController final : public iot::SensorService::Service, public Observable {
 public:
     // Constructor menerima shared_ptr ke BridgeManager
-    // agar SensorController bisa meneruskan data ke semua transport adapter
-    explicit SensorController(std::shared_ptr<BridgeManager> bridge);
+    // agar SensorController bisa meneruskan data ke semua transport adapter.
+    // pipeline_config mengatur antrian antara handler gRPC dan observer/bridge.
+    explicit SensorController(std::shared_ptr<BridgeManager> bridge,
+                              const IngestPipelineConfig& pipeline_config = IngestPipelineConfig());
 
     /**
      * Unary RPC -- Client kirim 1 request, server balas 1 response.
@@ -77,8 +81,46 @@ public:
     grpc::Status InteractiveSensor(grpc::ServerContext* context,
                                   grpc::ServerReaderWriter<iot::SensorResponse, iot::SensorRequest>* stream) override;
 
+    /**
+     * Batch Unary RPC -- Client kirim 1 SensorBatch berisi banyak data sensor
+     * dalam format kolom, server balas 1 response.
+     * Seluruh batch diteruskan ke observer dan bridge sebagai SATU unit.
+     */
+    grpc::Status SendSensorBatch(grpc::ServerContext* context,
+                                const iot::SensorBatch* batch,
+                                iot::SensorResponse* response) override;
+
+    /**
+     * Pipeline ingest (untuk statistik), atau null jika data diproses inline.
+     */
+    const IngestPipeline* pipeline() const { return pipeline_.get(); }
+
 private:
+    /**
+     * Teruskan satu data sensor ke observer + bridge (via pipeline jika aktif).
+     * @return RESOURCE_EXHAUSTED jika antrian penuh dengan policy REJECT
+     */
+    grpc::Status ingest(const SensorSample& sample);
+
+    /**
+     * Konversi SensorRequest ke SensorSample lalu ingest(sample).
+     * @return INVALID_ARGUMENT / RESOURCE_EXHAUSTED jika string tidak bisa di-intern
+     */
+    grpc::Status ingest(const iot::SensorRequest& request);
+
+    /**
+     * Teruskan satu batch data sensor sebagai satu unit (via pipeline jika aktif).
+     * @return RESOURCE_EXHAUSTED jika antrian penuh dengan policy REJECT
+     */
+    grpc::Status ingest_batch(absl::Span<const SensorSample> batch);
+
     // Pointer ke BridgeManager -- digunakan untuk broadcast data sensor
     // ke semua transport adapter (WebSocket, DDS, dll.) yang terdaftar
     std::shared_ptr<BridgeManager> bridge_;
+
+    // Antrian + dispatcher antara handler gRPC dan observer/bridge.
+    // nullptr jika pipeline dinonaktifkan (proses inline).
+    // Dideklarasikan SETELAH bridge_ agar dihancurkan lebih dulu
+    // (dispatcher berhenti sebelum bridge_ dilepas).
+    std::unique_ptr<IngestPipeline> pipeline_;
 };
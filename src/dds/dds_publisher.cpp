@@ -18,8 +18,26 @@
  */
 #include "dds_publisher.h"
 #include <spdlog/spdlog.h>
+#include <algorithm>
 #include <cstdlib>
 
+namespace {
+/**
+ * Baca environment variable bertipe integer (fallback jika kosong/tidak valid).
+ */
+long long env_int(const char* name, long long fallback) {
+    const char* value = std::getenv(name);
+    if (!value || !*value) {
+        return fallback;
+    }
+    try {
+        return std::stoll(value);
+    } catch (...) {
+        return fallback;
+    }
+}
+}  // namespace
+
 /**
  * Constructor: inisialisasi semua member ke null.
  * CORBA menggunakan _var (smart pointer) yang auto-release saat destructor.
@@ -39,6 +57,16 @@ DdsPublisher::DdsPublisher()
  * entity (topic, publisher, writer) sekaligus.
  */
 DdsPublisher::~DdsPublisher() {
+    // Hentikan flusher; flush_loop() menulis sisa batch sebelum keluar
+    if (flusher_.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(batch_mutex_);
+            stopping_ = true;
+        }
+        batch_cv_.notify_all();
+        flusher_.join();
+    }
+
     if (!CORBA::is_nil(participant_.in())) {
         participant_->delete_contained_entities();  // Hapus semua child entity
         DDS::DomainParticipantFactory_var dpf = TheParticipantFactory;
@@ -156,6 +184,11 @@ bool DdsPublisher::init(int argc, char* argv[]) {
             return false;
         }
 
+        // Langkah 7 (opsional): topic + DataWriter MessageBatch untuk mode batch
+        if (!init_batch_writer()) {
+            return false;
+        }
+
         spdlog::info("DDS: Initialized successfully (domain={}, topic={})", domain, topic_name);
         return true;
 
@@ -172,10 +205,12 @@ bool DdsPublisher::init(int argc, char* argv[]) {
  * Publish data sensor ke DDS network.
  * 
  * Proses:
- *   1. Cek apakah DataWriter sudah terinisialisasi
- *   2. Buat Messengger::Message (IDL struct) dan isi field-fieldnya
- *   3. Tulis message ke topic via DataWriter
- *   4. DDS akan otomatis mengirim ke semua subscriber di domain yang sama
+ *   1. Buat Messengger::Message (IDL struct) dan isi field-fieldnya
+ *   2. Teruskan ke publish(msg):
+ *      - mode biasa: tulis ke topic via DataWriter dengan InstanceHandle
+ *        sensor yang sudah di-cache (lihat instance_handle())
+ *      - mode batch: tambahkan ke MessageBatch (lihat append_to_batch())
+ *   3. DDS akan otomatis mengirim ke semua subscriber di domain yang sama
  * 
  * @param id    ID sensor
  * @param name  Nama sensor
@@ -188,11 +223,6 @@ bool DdsPublisher::init(int argc, char* argv[]) {
  */
 void DdsPublisher::publish(long id, const std::string& name, double temp, double hum, 
                            double press, double light, long long ts, const std::string& loc) {
-    if (CORBA::is_nil(writer_.in())) {
-        spdlog::warn("DDS: DataWriter not initialized");
-        return;
-    }
-
     // Buat IDL message dan isi semua field
     // Messengger::Message didefinisikan di SensorData.idl
     Messengger::Message msg;
@@ -205,12 +235,207 @@ void DdsPublisher::publish(long id, const std::string& name, double temp, double
     msg.timestamp = static_cast<CORBA::LongLong>(ts);       // Cast ke CORBA 64-bit
     msg.location = loc.c_str();
 
-    // Tulis ke DDS topic
-    // HANDLE_NIL berarti DDS akan auto-register instance
-    DDS::ReturnCode_t ret = writer_->write(msg, DDS::HANDLE_NIL);
+    publish(msg);
+}
+
+/**
+ * Publish satu Messengger::Message.
+ * 
+ * Mode batch: tambahkan ke batch (ditulis nanti oleh append/flusher).
+ * Mode biasa: tulis langsung sebagai satu sample.
+ * 
+ * @param msg Data sensor dalam format IDL
+ */
+void DdsPublisher::publish(const Messengger::Message& msg) {
+    if (batch_config_.enabled) {
+        append_to_batch(msg);
+        return;
+    }
+
+    if (CORBA::is_nil(writer_.in())) {
+        spdlog::warn("DDS: DataWriter not initialized");
+        return;
+    }
+
+    // Tulis ke DDS topic dengan handle instance sensor ini.
+    // Jika registrasi gagal, HANDLE_NIL membuat DDS mencari instance sendiri.
+    DDS::ReturnCode_t ret = writer_->write(msg, instance_handle(msg));
     if (ret == DDS::RETCODE_OK) {
-        spdlog::info("DDS: Published - ID: {}, Name: {}, Temp: {}C", id, name, temp);
+        spdlog::debug("DDS: Published - ID: {}, Name: {}, Temp: {}C",
+                      msg.sensor_id, msg.sensor_name.in(), msg.temperature);
     } else {
         spdlog::error("DDS: Write failed with code {}", static_cast<int>(ret));
     }
 }
+
+/**
+ * Ambil InstanceHandle untuk sensor di msg.
+ * 
+ * Data pertama dari sebuah sensor: register_instance() (DDS menghitung
+ * key dan mengalokasikan instance), handle disimpan di cache.
+ * Data berikutnya: cukup lookup di flat_hash_map.
+ * 
+ * @param msg Message yang akan ditulis (sensor_id = key instance)
+ * @return Handle instance, atau HANDLE_NIL jika registrasi gagal
+ */
+DDS::InstanceHandle_t DdsPublisher::instance_handle(const Messengger::Message& msg) {
+    std::lock_guard<std::mutex> lock(instances_mutex_);
+
+    auto it = instances_.find(msg.sensor_id);
+    if (it != instances_.end()) {
+        return it->second;
+    }
+
+    DDS::InstanceHandle_t handle = writer_->register_instance(msg);
+    if (handle == DDS::HANDLE_NIL) {
+        spdlog::warn("DDS: Failed to register instance for sensor {}", msg.sensor_id);
+        return DDS::HANDLE_NIL;  // Tidak di-cache, dicoba lagi pada data berikutnya
+    }
+
+    instances_.emplace(msg.sensor_id, handle);
+    spdlog::debug("DDS: Registered instance for sensor {} ({} cached)", msg.sensor_id, instances_.size());
+    return handle;
+}
+
+/**
+ * Baca konfigurasi mode batch lalu buat entity DDS untuk MessageBatch.
+ * 
+ * Environment variables:
+ *   - DDS_BATCH_MODE       : "on" untuk mengaktifkan (default: off)
+ *   - DDS_BATCH_MAX        : maksimal data per batch (default: 64, maks MAX_BATCH_READINGS)
+ *   - DDS_BATCH_LATENCY_US : batas tunggu data tertua dalam mikrodetik (default: 2000)
+ *   - DDS_BATCH_TOPIC      : nama topic batch (default: "TestData_MsgBatch")
+ * 
+ * @return true jika mode batch nonaktif atau berhasil disiapkan
+ */
+bool DdsPublisher::init_batch_writer() {
+    const char* mode = std::getenv("DDS_BATCH_MODE");
+    batch_config_.enabled = mode && std::string(mode) == "on";
+    if (!batch_config_.enabled) {
+        return true;
+    }
+
+    long long max_readings = env_int("DDS_BATCH_MAX", static_cast<long long>(batch_config_.max_readings));
+    batch_config_.max_readings = static_cast<size_t>(
+        std::clamp<long long>(max_readings, 1, Messengger::MAX_BATCH_READINGS));
+    batch_config_.max_latency = std::chrono::microseconds(
+        std::max<long long>(env_int("DDS_BATCH_LATENCY_US", batch_config_.max_latency.count()), 1));
+    const char* topic_env = std::getenv("DDS_BATCH_TOPIC");
+    if (topic_env && *topic_env) {
+        batch_config_.topic = topic_env;
+    }
+
+    // Register type MessageBatch, buat topic dan DataWriter (pola sama dengan Message)
+    Messengger::MessageBatchTypeSupport_var ts = new Messengger::MessageBatchTypeSupportImpl();
+    if (ts->register_type(participant_.in(), "") != DDS::RETCODE_OK) {
+        spdlog::error("DDS: Failed to register batch type");
+        return false;
+    }
+
+    CORBA::String_var type_name = ts->get_type_name();
+    batch_topic_ = participant_->create_topic(
+        batch_config_.topic.c_str(),
+        type_name.in(),
+        TOPIC_QOS_DEFAULT,
+        DDS::TopicListener::_nil(),
+        OpenDDS::DCPS::DEFAULT_STATUS_MASK
+    );
+    if (CORBA::is_nil(batch_topic_.in())) {
+        spdlog::error("DDS: Failed to create batch Topic '{}'", batch_config_.topic);
+        return false;
+    }
+
+    DDS::DataWriter_var dw = publisher_->create_datawriter(
+        batch_topic_.in(),
+        DATAWRITER_QOS_DEFAULT,
+        DDS::DataWriterListener::_nil(),
+        OpenDDS::DCPS::DEFAULT_STATUS_MASK
+    );
+    batch_writer_ = Messengger::MessageBatchDataWriter::_narrow(dw.in());
+    if (CORBA::is_nil(batch_writer_.in())) {
+        spdlog::error("DDS: Failed to narrow batch DataWriter");
+        return false;
+    }
+
+    flusher_ = std::thread(&DdsPublisher::flush_loop, this);
+
+    spdlog::info("DDS: Batch mode enabled (topic={}, max={}, latency={}us)",
+                 batch_config_.topic, batch_config_.max_readings, batch_config_.max_latency.count());
+    return true;
+}
+
+/**
+ * Tambahkan data ke batch yang sedang dikumpulkan.
+ * Data pertama dalam batch mencatat waktu mulai dan membangunkan flusher
+ * (yang lalu menunggu sampai batas latency). Batch penuh langsung ditulis.
+ * 
+ * @param msg Data sensor dalam format IDL
+ */
+void DdsPublisher::append_to_batch(const Messengger::Message& msg) {
+    std::lock_guard<std::mutex> lock(batch_mutex_);
+
+    CORBA::ULong count = pending_.readings.length();
+    if (count == 0) {
+        pending_since_ = std::chrono::steady_clock::now();
+        batch_cv_.notify_one();
+    }
+    pending_.readings.length(count + 1);
+    pending_.readings[count] = msg;
+
+    if (pending_.readings.length() >= batch_config_.max_readings) {
+        flush_locked();  // Batas ukuran tercapai
+    }
+}
+
+void DdsPublisher::flush() {
+    if (!batch_config_.enabled) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(batch_mutex_);
+    flush_locked();
+}
+
+/**
+ * Tulis batch sebagai satu sample MessageBatch, lalu kosongkan.
+ * Buffer sequence (bounded) dipakai ulang untuk batch berikutnya.
+ */
+void DdsPublisher::flush_locked() {
+    CORBA::ULong count = pending_.readings.length();
+    if (count == 0 || CORBA::is_nil(batch_writer_.in())) {
+        return;
+    }
+
+    pending_.batch_seq = batch_seq_++;
+    DDS::ReturnCode_t ret = batch_writer_->write(pending_, DDS::HANDLE_NIL);
+    if (ret == DDS::RETCODE_OK) {
+        spdlog::debug("DDS: Published batch #{} ({} reading(s))", pending_.batch_seq, count);
+    } else {
+        spdlog::error("DDS: Batch write failed with code {} ({} reading(s) lost)",
+                      static_cast<int>(ret), count);
+    }
+    pending_.readings.length(0);
+}
+
+/**
+ * Loop thread flusher.
+ * Tidur sampai ada batch, lalu tunggu sampai data tertua mencapai
+ * max_latency. Jika batch belum di-flush karena ukuran, tulis sekarang.
+ * Saat shutdown, sisa batch ditulis sebelum thread berhenti.
+ */
+void DdsPublisher::flush_loop() {
+    std::unique_lock<std::mutex> lock(batch_mutex_);
+    while (!stopping_) {
+        if (pending_.readings.length() == 0) {
+            batch_cv_.wait(lock);
+            continue;
+        }
+
+        auto deadline = pending_since_ + batch_config_.max_latency;
+        if (std::chrono::steady_clock::now() >= deadline) {
+            flush_locked();  // Batas latency tercapai
+            continue;
+        }
+        batch_cv_.wait_until(lock, deadline);
+    }
+    flush_locked();
+}
@@ -4,8 +4,24 @@
 #include <dds/DCPS/Service_Participant.h>
 #include <dds/DCPS/WaitSet.h>
 #include "SensorDataTypeSupportImpl.h"
+#include <absl/container/flat_hash_map.h>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+
+/**
+ * Konfigurasi mode batch DdsPublisher (dibaca dari environment di init()).
+ */
+struct DdsBatchConfig {
+    bool enabled = false;                          // DDS_BATCH_MODE: "on" untuk mengaktifkan
+    size_t max_readings = 64;                      // DDS_BATCH_MAX: flush saat batch berisi sebanyak ini
+    std::chrono::microseconds max_latency{2000};   // DDS_BATCH_LATENCY_US: batas tunggu data tertua
+    std::string topic = "TestData_MsgBatch";       // DDS_BATCH_TOPIC: topic MessageBatch
+};
 
 /**
  * DdsPublisher -- Publisher untuk OpenDDS Network
@@ -29,8 +45,24 @@
  *   - DDS_DOMAIN : domain ID untuk DDS (default: 0)
  *   - TEST_TOPIC : nama topic DDS (default: "TestData_Msg")
  *   - DDS_CONFIG_FILE : path ke file konfigurasi RTPS (default: "rtps.ini")
+ *   - DDS_BATCH_*     : mode batch (lihat DdsBatchConfig)
  * 
- * IDL type yang digunakan: Messengger::Message (dari SensorData.idl)
+ * IDL type yang digunakan: Messengger::Message dan Messengger::MessageBatch
+ * (dari SensorData.idl)
+ * 
+ * Instance per sensor:
+ *   sensor_id adalah @key di IDL, jadi setiap sensor adalah instance DDS
+ *   tersendiri. Instance didaftarkan SEKALI (register_instance) saat data
+ *   pertama sensor itu dikirim; InstanceHandle_t-nya di-cache sehingga
+ *   write() berikutnya tidak perlu lookup instance per sample.
+ * 
+ * Mode batch (DDS_BATCH_MODE=on):
+ *   publish() tidak langsung menulis, tetapi menambahkan data ke
+ *   Messengger::MessageBatch yang sedang dikumpulkan. Batch ditulis sebagai
+ *   SATU sample ke topic batch jika:
+ *     - jumlah data mencapai max_readings, ATAU
+ *     - data tertua di batch sudah menunggu max_latency (thread flusher)
+ *   Satu serialisasi + satu RTPS submessage untuk N data.
  */
 class DdsPublisher {
 public:
@@ -38,7 +70,8 @@ public:
 
     /**
      * Destructor: bersihkan semua resource DDS.
-     * Menghapus semua entity yang dibuat (participant, topic, publisher, writer).
+     * Thread flusher dihentikan dan sisa batch ditulis lebih dulu, lalu
+     * semua entity yang dibuat (participant, topic, publisher, writer) dihapus.
      */
     ~DdsPublisher();
 
@@ -68,9 +101,66 @@ public:
     void publish(long id, const std::string& name, double temp, double hum, double press, 
                  double light, long long ts, const std::string& loc);
 
+    /**
+     * Publish satu Messengger::Message yang sudah tersusun.
+     * Mode batch: ditambahkan ke batch yang sedang dikumpulkan.
+     * @param msg Data sensor dalam format IDL
+     */
+    void publish(const Messengger::Message& msg);
+
+    /**
+     * Tulis batch yang sedang dikumpulkan sekarang juga (no-op jika kosong
+     * atau mode batch tidak aktif).
+     */
+    void flush();
+
 private:
+    /**
+     * Baca DDS_BATCH_* lalu buat topic + DataWriter MessageBatch jika aktif.
+     * @return false jika mode batch aktif tetapi entity DDS gagal dibuat
+     */
+    bool init_batch_writer();
+
+    /**
+     * Tambahkan msg ke batch; flush jika batch penuh.
+     */
+    void append_to_batch(const Messengger::Message& msg);
+
+    /**
+     * Tulis batch ke DDS lalu kosongkan. Harus dipanggil dengan batch_mutex_ terkunci.
+     */
+    void flush_locked();
+
+    /**
+     * Loop thread flusher: tulis batch yang data tertuanya melewati max_latency.
+     */
+    void flush_loop();
+
+
+    /**
+     * Ambil InstanceHandle untuk sensor di msg (daftarkan jika belum ada).
+     * @return Handle yang di-cache, atau HANDLE_NIL jika registrasi gagal
+     */
+    DDS::InstanceHandle_t instance_handle(const Messengger::Message& msg);
+
     DDS::DomainParticipant_var participant_;  // Titik masuk ke DDS domain
     DDS::Topic_var topic_;                    // Topic tempat data di-publish
     DDS::Publisher_var publisher_;            // Objek publisher DDS
     Messengger::MessageDataWriter_var writer_; // DataWriter untuk menulis ke topic
+
+    // Cache sensor_id -> InstanceHandle_t (satu instance DDS per sensor)
+    absl::flat_hash_map<CORBA::Long, DDS::InstanceHandle_t> instances_;
+    std::mutex instances_mutex_;  // publish() bisa dipanggil dari beberapa thread (mode inline)
+
+    // Mode batch
+    DdsBatchConfig batch_config_;
+    DDS::Topic_var batch_topic_;                          // Topic MessageBatch
+    Messengger::MessageBatchDataWriter_var batch_writer_; // DataWriter MessageBatch
+    Messengger::MessageBatch pending_;                    // Batch yang sedang dikumpulkan
+    std::chrono::steady_clock::time_point pending_since_; // Waktu data pertama masuk batch
+    uint64_t batch_seq_ = 0;                              // Nomor urut batch berikutnya
+    std::mutex batch_mutex_;                              // Melindungi pending_ dan batch_seq_
+    std::condition_variable batch_cv_;                    // Membangunkan flusher
+    std::thread flusher_;                                 // Thread flush berbasis latency
+    bool stopping_ = false;                               // Dilindungi batch_mutex_
 };
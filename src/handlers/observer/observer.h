@@ -1,5 +1,6 @@
 #pragma once
-#include "sensor.pb.h"
+#include "pipeline/sensor_sample.h"
+#include <absl/types/span.h>
 #include <string>
 
 /**
@@ -15,6 +16,13 @@
  * Contoh concrete observers:
  *   - SensorDataLogHandler  → log detail data ke console
  *   - SensorDataValidator   → validasi data, alert jika abnormal
+ * 
+ * Dua entry point:
+ *   - on_sensor_data()  → satu data (wajib di-implement)
+ *   - on_sensor_batch() → banyak data sekaligus dari IngestPipeline.
+ *                         Default-nya loop on_sensor_data(); override jika
+ *                         observer bisa memproses batch lebih efisien
+ *                         (misalnya update counter/lock sekali per batch).
  */
 class Observer {
 public:
@@ -22,9 +30,20 @@ public:
 
     /**
      * Dipanggil oleh Observable saat ada data sensor baru.
-     * @param request Data sensor yang diterima dari gRPC client
+     * @param sample Data sensor yang diterima dari gRPC client
+     */
+    virtual void on_sensor_data(const SensorSample& sample) = 0;
+
+    /**
+     * Dipanggil oleh Observable saat ada satu batch data sensor baru.
+     * Implementasi default: panggil on_sensor_data() untuk setiap data.
+     * @param batch Kumpulan data sensor (urutan sesuai urutan masuk)
      */
-    virtual void on_sensor_data(const iot::SensorRequest& request) = 0;
+    virtual void on_sensor_batch(absl::Span<const SensorSample> batch) {
+        for (const auto& sample : batch) {
+            on_sensor_data(sample);
+        }
+    }
 
     /**
      * Nama observer (untuk logging/debug)
@@ -0,0 +1,193 @@
+#pragma once
+#include "pipeline/sensor_sample.h"
+#include <absl/container/flat_hash_map.h>
+#include <absl/types/span.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * log_sampler.h -- Sampling log per sensor
+ *
+ * Di produksi tidak mungkin me-log setiap data, tetapi setiap sensor tetap
+ * perlu terlihat di log. LogSampler memutuskan per sensor_id data mana yang
+ * di-log, sehingga volume log dibatasi PER SENSOR (bukan global -- sensor
+ * yang ramai tidak menenggelamkan sensor yang jarang mengirim):
+ *
+ *   - "all"     : log semua data (default, perilaku lama)
+ *   - "every_n" : 1 dari setiap N data per sensor (data pertama selalu di-log)
+ *   - "rate"    : maksimal K record/detik per sensor (token bucket,
+ *                 burst = K; sensor baru mulai dengan bucket penuh)
+ *
+ * Data yang tidak di-log dihitung per sensor; record berikutnya untuk
+ * sensor itu membawa jumlahnya (skipped=...). Anomali (lihat
+ * SensorDataValidator::violations()) tidak melewati sampler sama sekali --
+ * selalu di-log oleh SensorDataLogHandler jika always_log_anomalies aktif.
+ *
+ * Thread-safety: satu mutex; admit_batch() mengambilnya sekali per batch.
+ *
+ * Nilai dari environment variable (lihat load_log_sampling_config() di app.cpp):
+ *   LOG_SAMPLING, LOG_SAMPLE_EVERY_N, LOG_SAMPLE_RATE, LOG_SAMPLE_ANOMALIES
+ */
+enum class LogSamplingMode {
+    ALL,      // Log semua data
+    EVERY_N,  // 1 dari N per sensor
+    RATE      // Maksimal K record/detik per sensor
+};
+
+/**
+ * Konfigurasi sampling log.
+ */
+struct LogSamplingConfig {
+    LogSamplingMode mode = LogSamplingMode::ALL;
+    uint32_t every_n = 100;             // Mode EVERY_N: log 1 dari N data per sensor
+    uint32_t per_second = 1;            // Mode RATE: maksimal record/detik per sensor
+    bool always_log_anomalies = true;   // Data anomali selalu di-log (melewati sampler)
+};
+
+class LogSampler {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /// Data yang di-log dari satu batch
+    struct Admitted {
+        uint32_t index;    // Posisi di batch
+        uint64_t skipped;  // Data sensor ini yang tidak di-log sejak record sebelumnya
+        bool forced;       // Di-log tanpa melewati sampler (force_log)
+    };
+
+    explicit LogSampler(const LogSamplingConfig& config = {}) : config_(config) {
+        config_.every_n = std::max<uint32_t>(config_.every_n, 1);
+        config_.per_second = std::max<uint32_t>(config_.per_second, 1);
+    }
+
+    /**
+     * Putuskan apakah satu data sensor di-log.
+     * @param sensor_id ID sensor
+     * @param now       Waktu sekarang (untuk mode RATE)
+     * @param skipped   [out] Jumlah data sensor ini yang dilewati sejak record sebelumnya
+     * @return true jika data ini di-log
+     */
+    bool admit(int32_t sensor_id, Clock::time_point now, uint64_t& skipped) {
+        skipped = 0;
+        if (config_.mode == LogSamplingMode::ALL) {
+            return true;
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        return admit_locked(sensor_id, now, skipped);
+    }
+
+    /**
+     * Versi batch dari admit(): satu lock untuk seluruh batch.
+     * @param batch     Data sensor
+     * @param now       Waktu sekarang (untuk mode RATE)
+     * @param force_log bool(const SensorSample&) -- true = selalu di-log,
+     *                  tanpa mengubah state sampling sensor tersebut
+     * @param out       [out] Dikosongkan lalu diisi data yang di-log (urut)
+     */
+    template <typename ForceLog>
+    void admit_batch(absl::Span<const SensorSample> batch, Clock::time_point now,
+                     ForceLog&& force_log, std::vector<Admitted>& out) {
+        out.clear();
+        std::unique_lock<std::mutex> lock(mutex_, std::defer_lock);
+        if (config_.mode != LogSamplingMode::ALL) {
+            lock.lock();
+        }
+        for (size_t i = 0; i < batch.size(); ++i) {
+            uint32_t index = static_cast<uint32_t>(i);
+            if (force_log(batch[i])) {
+                out.push_back({index, 0, true});
+                continue;
+            }
+            uint64_t skipped = 0;
+            if (config_.mode == LogSamplingMode::ALL || admit_locked(batch[i].sensor_id, now, skipped)) {
+                out.push_back({index, skipped, false});
+            }
+        }
+    }
+
+    const LogSamplingConfig& config() const {
+        return config_;
+    }
+
+private:
+    struct SensorState {
+        uint64_t seen = 0;               // Mode EVERY_N: jumlah data sejak awal
+        uint64_t skipped = 0;            // Data yang dilewati sejak record terakhir
+        double tokens = 0.0;             // Mode RATE: isi bucket
+        Clock::time_point refilled{};    // Mode RATE: terakhir bucket diisi
+        bool started = false;
+    };
+
+    bool admit_locked(int32_t sensor_id, Clock::time_point now, uint64_t& skipped) {
+        SensorState& state = sensors_[sensor_id];
+        bool log = false;
+
+        if (config_.mode == LogSamplingMode::EVERY_N) {
+            log = (state.seen++ % config_.every_n) == 0;
+        } else {
+            double capacity = static_cast<double>(config_.per_second);
+            if (!state.started) {
+                state.tokens = capacity;
+                state.refilled = now;
+                state.started = true;
+            } else if (now > state.refilled) {
+                double elapsed = std::chrono::duration<double>(now - state.refilled).count();
+                state.tokens = std::min(capacity, state.tokens + elapsed * capacity);
+                state.refilled = now;
+            }
+            if (state.tokens >= 1.0) {
+                state.tokens -= 1.0;
+                log = true;
+            }
+        }
+
+        if (!log) {
+            ++state.skipped;
+            return false;
+        }
+        skipped = state.skipped;
+        state.skipped = 0;
+        return true;
+    }
+
+    LogSamplingConfig config_;
+    std::mutex mutex_;
+    absl::flat_hash_map<int32_t, SensorState> sensors_;  // sensor_id -> state sampling
+};
+
+namespace utils {
+    /**
+     * Parse string menjadi LogSamplingMode.
+     *
+     * @param mode     String nama mode ("all", "every_n", "rate")
+     * @param fallback Mode default jika string tidak dikenali
+     */
+    inline LogSamplingMode parse_log_sampling_mode(const std::string& mode, LogSamplingMode fallback) {
+        if (mode == "all") {
+            return LogSamplingMode::ALL;
+        }
+        if (mode == "every_n") {
+            return LogSamplingMode::EVERY_N;
+        }
+        if (mode == "rate") {
+            return LogSamplingMode::RATE;
+        }
+        return fallback;
+    }
+
+    /**
+     * Nama mode untuk logging.
+     */
+    inline const char* log_sampling_mode_name(LogSamplingMode mode) {
+        switch (mode) {
+        case LogSamplingMode::ALL:     return "all";
+        case LogSamplingMode::EVERY_N: return "every_n";
+        case LogSamplingMode::RATE:    return "rate";
+        }
+        return "unknown";
+    }
+}
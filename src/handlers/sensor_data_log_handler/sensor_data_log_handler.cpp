@@ -1,19 +1,102 @@
 #include "sensor_data_log_handler.h"
+#include "handlers/sensor_data_validator/sensor_data_validator.h"
+#include "sensor_fields.h"
+#include "utils/log_util/logger.h"
+#include <spdlog/fmt/fmt.h>
+#include <iterator>
 
-void SensorDataLogHandler::on_sensor_data(const iot::SensorRequest& request) {
-    spdlog::info("┌─────────── [DataLogger] Sensor Report ───────────┐");
-    spdlog::info("│ Sensor ID      : {}",   request.sensor_id());
-    spdlog::info("│ Sensor Name    : {}",   request.sensor_name());
-    spdlog::info("│ Temperature    : {}°C", request.temperature());
-    spdlog::info("│ Humidity       : {}%",  request.humidity());
-    spdlog::info("│ Pressure       : {} hPa", request.pressure());
-    spdlog::info("│ Light Intensity: {} lux",  request.light_intensity());
-    spdlog::info("│ Timestamp      : {}",   request.timestamp());
-    spdlog::info("│ Location       : {}",   request.location());
-    spdlog::info("└─────────────────────────────────────────────────┘");
+SensorDataLogHandler::SensorDataLogHandler(const LogSamplingConfig& sampling,
+                                           std::shared_ptr<BinaryJournal> journal, bool text_log)
+    : sampler_(sampling), journal_(std::move(journal)), text_log_(text_log || !journal_) {
+    if (sampling.mode != LogSamplingMode::ALL) {
+        spdlog::info("[DataLogger] Sampling: mode={}, every_n={}, per_second={}, always_log_anomalies={}",
+                     utils::log_sampling_mode_name(sampling.mode), sampling.every_n,
+                     sampling.per_second, sampling.always_log_anomalies);
+    }
+}
+
+/**
+ * Journal biner (jika ada) menerima argumen mentah; record teks berupa
+ * satu baris key=value per data (field dan urutan dari sensor.proto):
+ *   [DataLogger] sensor_id=1 sensor_name="DHT22" temperature=25.5 ... location="Lab"
+ * Pesan dibentuk di buffer stack lalu dikirim dengan SATU panggilan log.
+ * Anomali ditulis di level warn dengan penanda anomaly=1; skipped=K muncul
+ * jika sampling melewatkan K data sensor ini sejak record sebelumnya.
+ */
+void SensorDataLogHandler::log_reading(const SensorSample& sample, uint64_t skipped, bool anomaly) const {
+    if (journal_) {
+        journal_->write_sensor(sample, skipped, anomaly);  // Argumen mentah, tanpa format teks
+    }
+    if (!text_log_) {
+        return;
+    }
+
+    spdlog::level::level_enum level = anomaly ? spdlog::level::warn : spdlog::level::info;
+    if (!spdlog::should_log(level)) {
+        return;  // Level terfilter: jangan format apa pun
+    }
+
+    fmt::memory_buffer record;
+    auto out = std::back_inserter(record);
+#define IOT_LOG_SCALAR(type, name, tag) fmt::format_to(out, " " #name "={}", sample.name);
+#define IOT_LOG_STRING(name, tag) fmt::format_to(out, " " #name "=\"{}\"", sample.name());
+    IOT_SENSOR_REQUEST_FIELDS(IOT_LOG_SCALAR, IOT_LOG_STRING)
+#undef IOT_LOG_SCALAR
+#undef IOT_LOG_STRING
+    if (skipped > 0) {
+        fmt::format_to(out, " skipped={}", skipped);
+    }
+    if (anomaly) {
+        fmt::format_to(out, " anomaly=1");
+    }
 
-    ++log_count_;
-    spdlog::debug("[DataLogger] Total logged: {} messages", log_count_);
+    spdlog::log(level, "[DataLogger]{}", fmt::string_view(record.data(), record.size()));
+}
+
+bool SensorDataLogHandler::is_anomaly(const SensorSample& sample) const {
+    return sampler_.config().always_log_anomalies && SensorDataValidator::violations(sample) != 0;
+}
+
+void SensorDataLogHandler::on_sensor_data(const SensorSample& sample) {
+    uint64_t skipped = 0;
+    bool anomaly = is_anomaly(sample);
+    if (!anomaly && !sampler_.admit(sample.sensor_id, LogSampler::Clock::now(), skipped)) {
+        ++sampled_out_count_;
+        return;
+    }
+    log_reading(sample, skipped, anomaly);
+
+    int total = ++log_count_;
+    // Argumen dievaluasi sebelum cek level, dan log_dropped_count() mengunci
+    // registry spdlog + antrian async -- lewati seluruhnya jika debug nonaktif
+    if (spdlog::should_log(spdlog::level::debug)) {
+        spdlog::debug("[DataLogger] Total logged: {} messages (sampled out: {}, log records dropped: {})",
+                      total, sampled_out_count_.load(), utils::log_dropped_count());
+    }
+}
+
+void SensorDataLogHandler::on_sensor_batch(absl::Span<const SensorSample> batch) {
+    // Buffer milik thread dispatcher ini, dipakai ulang antar batch
+    thread_local std::vector<LogSampler::Admitted> admitted;
+    sampler_.admit_batch(batch, LogSampler::Clock::now(),
+                         [this](const SensorSample& sample) { return is_anomaly(sample); },
+                         admitted);
+
+    for (const auto& entry : admitted) {
+        log_reading(batch[entry.index], entry.skipped, entry.forced);
+    }
+
+    int logged = static_cast<int>(admitted.size());
+    int sampled_out = static_cast<int>(batch.size()) - logged;
+    if (sampled_out > 0) {
+        sampled_out_count_ += sampled_out;
+    }
+    int total = log_count_.fetch_add(logged) + logged;
+    if (spdlog::should_log(spdlog::level::debug)) {
+        spdlog::debug("[DataLogger] Total logged: {} messages (+{} of {} in batch, sampled out: {}, "
+                      "log records dropped: {})",
+                      total, logged, batch.size(), sampled_out_count_.load(), utils::log_dropped_count());
+    }
 }
 
 std::string SensorDataLogHandler::observer_name() const {
@@ -23,3 +106,7 @@ std::string SensorDataLogHandler::observer_name() const {
 int SensorDataLogHandler::get_log_count() const {
     return log_count_;
 }
+
+int SensorDataLogHandler::get_sampled_out_count() const {
+    return sampled_out_count_;
+}
@@ -1,21 +1,37 @@
 #pragma once
 #include "handlers/observer/observer.h"
+#include "log_sampler.h"
+#include "utils/log_util/binary_journal.h"
 #include <spdlog/spdlog.h>
+#include <atomic>
+#include <cstdint>
+#include <memory>
 
 /**
  * SensorDataLogHandler — Concrete Observer #1
  * 
  * Observer ini bertugas mencatat (log) SEMUA data sensor yang masuk
- * secara detail ke console. Ini berguna untuk:
+ * ke console, SATU baris key=value per data (semua field SensorRequest).
+ * Dengan logger async (lihat utils::init_logger()), biaya di thread data
+ * hanya format + enqueue; penulisan ke stdout terjadi di thread logger.
+ * Ini berguna untuk:
  *   - Debugging (lihat semua field data sensor)
  *   - Audit trail (record setiap data yang melewati sistem)
  *   - Monitoring (lihat real-time apa yang terjadi)
  * 
  * Observer Pattern chain:
  *   SensorController (Observable)
- *       → notify_observers(request)
- *           → SensorDataLogHandler::on_sensor_data(request)  ← INI
- *           → SensorDataValidator::on_sensor_data(request)
+ *       → notify_observers(sample)
+ *           → SensorDataLogHandler::on_sensor_data(sample)  ← INI
+ *           → SensorDataValidator::on_sensor_data(sample)
+ * 
+ * Sampling (LogSamplingConfig, lihat log_sampler.h): volume log bisa
+ * dibatasi per sensor (1 dari N, atau K record/detik). Data yang melanggar
+ * aturan SensorDataValidator::violations() tetap SELALU di-log (level warn)
+ * jika always_log_anomalies aktif.
+ * 
+ * Sink: record teks (spdlog) dan/atau journal biner (BinaryJournal,
+ * di-decode offline dengan iot_logdecode). Sampling berlaku untuk keduanya.
  * 
  * Tanpa Observer Pattern, nantinya harus menulis log ini LANGSUNG
  * di SensorController — itu membuat controller "gemuk" dan susah di-maintain.
@@ -23,17 +39,53 @@
  */
 class SensorDataLogHandler : public Observer {
 public:
+    /**
+     * @param sampling Policy sampling log per sensor (default: log semua data)
+     * @param journal  Journal biner (nullptr = tanpa journal)
+     * @param text_log false = tidak menulis record teks (hanya journal)
+     */
+    explicit SensorDataLogHandler(const LogSamplingConfig& sampling = {},
+                                  std::shared_ptr<BinaryJournal> journal = nullptr,
+                                  bool text_log = true);
+
     /**
      * Dipanggil otomatis oleh Observable saat ada data sensor baru.
-     * Log semua field sensor ke console dengan format terstruktur.
+     * Log semua field sensor ke console sebagai satu record key=value.
+     */
+    void on_sensor_data(const SensorSample& sample) override;
+
+    /**
+     * Log satu batch: setiap data tetap di-log lengkap, tetapi counter
+     * di-update dan total di-log SEKALI per batch.
      */
-    void on_sensor_data(const iot::SensorRequest& request) override;
+    void on_sensor_batch(absl::Span<const SensorSample> batch) override;
 
     std::string observer_name() const override;
 
     /// Getter — berapa total data yang sudah di-log
     int get_log_count() const;
 
+    /// Getter — berapa total data yang tidak di-log karena sampling
+    int get_sampled_out_count() const;
+
 private:
-    int log_count_ = 0;  // Counter untuk tracking jumlah data yang di-log
+    /**
+     * Tulis satu record untuk satu data sensor ke sink yang aktif
+     * (teks key=value dan/atau journal biner).
+     * @param skipped Data sensor ini yang dilewati sampling sejak record sebelumnya
+     * @param anomaly true = data anomali (level warn)
+     */
+    void log_reading(const SensorSample& sample, uint64_t skipped, bool anomaly) const;
+
+    /// Data anomali yang harus di-log walaupun sampling aktif
+    bool is_anomaly(const SensorSample& sample) const;
+
+    LogSampler sampler_;
+    std::shared_ptr<BinaryJournal> journal_;  // nullptr = tanpa journal biner
+    bool text_log_ = true;                    // Tulis record teks via spdlog
+
+    // Atomic: on_sensor_data() bisa dipanggil dari beberapa thread sekaligus
+    // (Observable tidak lagi mengambil mutex saat notify)
+    std::atomic<int> log_count_{0};          // Counter untuk tracking jumlah data yang di-log
+    std::atomic<int> sampled_out_count_{0};  // Data yang dilewati sampling
 };
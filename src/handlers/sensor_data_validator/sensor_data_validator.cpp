@@ -1,54 +1,111 @@
 #include "sensor_data_validator.h"
 
-void SensorDataValidator::on_sensor_data(const iot::SensorRequest& request) {
-    bool is_valid = true;
+uint32_t SensorDataValidator::violations(const SensorSample& sample) {
+    uint32_t mask = 0;
 
     // Validasi 1: Sensor ID harus positif
-    if (request.sensor_id() <= 0) {
-        spdlog::warn("[Validator] INVALID: sensor_id={} (harus > 0)", 
-                     request.sensor_id());
-        is_valid = false;
+    if (sample.sensor_id <= 0) {
+        mask |= INVALID_SENSOR_ID;
     }
 
     // Validasi 2: Temperature dalam range wajar (-50 to 100°C)
-    if (request.temperature() < -50.0 || request.temperature() > 100.0) {
-        spdlog::warn("[Validator]  ABNORMAL TEMP: {}°C (range normal: -50 to 100)", 
-                     request.temperature());
-        is_valid = false;
-        ++anomaly_count_;
+    if (sample.temperature < -50.0 || sample.temperature > 100.0) {
+        mask |= ABNORMAL_TEMP;
     }
 
     // Validasi 3: Humidity dalam range 0-100%
-    if (request.humidity() < 0.0 || request.humidity() > 100.0) {
-        spdlog::warn("[Validator]  INVALID HUMIDITY: {}% (range: 0-100)", 
-                     request.humidity());
-        is_valid = false;
-        ++anomaly_count_;
+    if (sample.humidity < 0.0 || sample.humidity > 100.0) {
+        mask |= INVALID_HUMIDITY;
     }
 
     // Validasi 4: Pressure dalam range wajar (300-1100 hPa)
-    if (request.pressure() < 300.0 || request.pressure() > 1100.0) {
-        spdlog::warn("[Validator]  ABNORMAL PRESSURE: {} hPa (range normal: 300-1100)", 
-                     request.pressure());
-        is_valid = false;
-        ++anomaly_count_;
+    if (sample.pressure < 300.0 || sample.pressure > 1100.0) {
+        mask |= ABNORMAL_PRESSURE;
     }
 
     // Validasi 5: Light intensity harus >= 0
-    if (request.light_intensity() < 0.0) {
+    if (sample.light_intensity < 0.0) {
+        mask |= INVALID_LIGHT;
+    }
+
+    return mask;
+}
+
+int SensorDataValidator::check(const SensorSample& sample, bool& is_valid) const {
+    uint32_t mask = violations(sample);
+    is_valid = (mask == 0);
+    if (is_valid) {
+        return 0;
+    }
+
+    int anomalies = 0;
+    if (mask & INVALID_SENSOR_ID) {
+        spdlog::warn("[Validator] INVALID: sensor_id={} (harus > 0)", 
+                     sample.sensor_id);
+    }
+    if (mask & ABNORMAL_TEMP) {
+        spdlog::warn("[Validator]  ABNORMAL TEMP: {}°C (range normal: -50 to 100)", 
+                     sample.temperature);
+        ++anomalies;
+    }
+    if (mask & INVALID_HUMIDITY) {
+        spdlog::warn("[Validator]  INVALID HUMIDITY: {}% (range: 0-100)", 
+                     sample.humidity);
+        ++anomalies;
+    }
+    if (mask & ABNORMAL_PRESSURE) {
+        spdlog::warn("[Validator]  ABNORMAL PRESSURE: {} hPa (range normal: 300-1100)", 
+                     sample.pressure);
+        ++anomalies;
+    }
+    if (mask & INVALID_LIGHT) {
         spdlog::warn("[Validator]  INVALID LIGHT: {} lux (must be >= 0)", 
-                     request.light_intensity());
-        is_valid = false;
-        ++anomaly_count_;
+                     sample.light_intensity);
+        ++anomalies;
+    }
+
+    return anomalies;
+}
+
+void SensorDataValidator::on_sensor_data(const SensorSample& sample) {
+    bool is_valid = true;
+    int anomalies = check(sample, is_valid);
+    if (anomalies > 0) {
+        anomaly_count_ += anomalies;
     }
 
     // Summary
     if (is_valid) {
-        spdlog::info("[Validator]  Data VALID");
+        spdlog::debug("[Validator]  Data VALID");  // Per data: info akan melewati LogSampler
         ++valid_count_;
     }
 }
 
+void SensorDataValidator::on_sensor_batch(absl::Span<const SensorSample> batch) {
+    int anomalies = 0;
+    int valid = 0;
+
+    // Loop ketat tanpa atomic per data -- counter lokal dulu
+    for (const auto& sample : batch) {
+        bool is_valid = true;
+        anomalies += check(sample, is_valid);
+        if (is_valid) {
+            ++valid;
+        }
+    }
+
+    if (anomalies > 0) {
+        anomaly_count_ += anomalies;
+    }
+    if (valid > 0) {
+        valid_count_ += valid;
+    }
+
+    // Summary (satu baris untuk seluruh batch)
+    spdlog::info("[Validator]  Batch: {} of {} VALID, {} anomaly(ies)",
+                 valid, batch.size(), anomalies);
+}
+
 std::string SensorDataValidator::observer_name() const {
     return "SensorDataValidator";
 }
@@ -1,6 +1,8 @@
 #pragma once
 #include "handlers/observer/observer.h"
 #include <spdlog/spdlog.h>
+#include <atomic>
+#include <cstdint>
 
 /**
  * SensorDataValidator — Concrete Observer #2
@@ -24,10 +26,34 @@
  */
 class SensorDataValidator : public Observer {
 public:
-    void on_sensor_data(const iot::SensorRequest& request) override;
+    void on_sensor_data(const SensorSample& sample) override;
+
+    /**
+     * Validasi satu batch: aturan yang sama dengan on_sensor_data(), tetapi
+     * counter di-update SEKALI per batch dan data valid diringkas dalam
+     * satu baris log (anomali tetap di-log per data).
+     */
+    void on_sensor_batch(absl::Span<const SensorSample> batch) override;
 
     std::string observer_name() const override;
 
+    /// Bit aturan validasi yang dilanggar (hasil violations())
+    enum Violation : uint32_t {
+        INVALID_SENSOR_ID = 1u << 0,  // sensor_id <= 0
+        ABNORMAL_TEMP     = 1u << 1,  // di luar -50..100 °C
+        INVALID_HUMIDITY  = 1u << 2,  // di luar 0..100 %
+        ABNORMAL_PRESSURE = 1u << 3,  // di luar 300..1100 hPa
+        INVALID_LIGHT     = 1u << 4   // < 0 lux
+    };
+
+    /**
+     * Evaluasi semua aturan validasi TANPA logging dan tanpa mengubah counter.
+     * Dipakai juga oleh observer lain (misalnya SensorDataLogHandler untuk
+     * selalu me-log data anomali walaupun sampling aktif).
+     * @return Gabungan bit Violation; 0 jika data valid
+     */
+    static uint32_t violations(const SensorSample& sample);
+
     /// Getter — berapa total anomali yang terdeteksi
     int get_anomaly_count() const;
 
@@ -35,6 +61,15 @@ public:
     int get_valid_count() const;
 
 private:
-    int anomaly_count_ = 0;  // Counter anomali yang terdeteksi
-    int valid_count_ = 0;    // Counter data yang valid
+    /**
+     * Jalankan semua aturan validasi pada satu data (log WARNING per pelanggaran).
+     * @param sample  Data yang divalidasi
+     * @param is_valid Diisi false jika ada aturan yang dilanggar (termasuk sensor_id)
+     * @return Jumlah anomali terukur (temp/humidity/pressure/light) pada data ini
+     */
+    int check(const SensorSample& sample, bool& is_valid) const;
+
+    // Atomic: on_sensor_data() bisa dipanggil dari beberapa thread sekaligus
+    std::atomic<int> anomaly_count_{0};  // Counter anomali yang terdeteksi
+    std::atomic<int> valid_count_{0};    // Counter data yang valid
 };
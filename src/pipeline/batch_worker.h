@@ -0,0 +1,280 @@
+#pragma once
+#include "pipeline/bounded_queue.h"
+#include "pipeline/overflow_policy.h"
+#include <absl/types/span.h>
+#include <spdlog/spdlog.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ * batch_worker.h -- Antrian bounded + thread worker yang memproses per batch
+ *
+ * Blok bangunan untuk semua tahap (stage) asynchronous di project ini:
+ *   - IngestPipeline : antara controller gRPC dan observer/BridgeManager
+ *   - BridgeManager  : satu BatchWorker per transport adapter
+ *
+ *   producer (banyak thread)          worker (config.threads)
+ *   ------------------------          -----------------------
+ *   push() / push_batch()  --> [BoundedQueue] --> drain sampai max_batch
+ *                                                  -> handler(span)
+ *
+ * Producer tidak pernah mengambil mutex di jalur normal. Worker yang
+ * antriannya kosong tidur di condition variable, dan producer hanya
+ * mengambil mutex untuk membangunkannya jika memang ada yang tidur.
+ */
+
+/**
+ * Konfigurasi BatchWorker.
+ */
+struct BatchWorkerConfig {
+    size_t queue_depth = 8192;                        // Kapasitas antrian (dibulatkan ke pangkat 2)
+    size_t threads = 1;                               // Jumlah thread worker (1 = urutan terjaga)
+    size_t max_batch = 256;                           // Maksimal item per panggilan handler
+    OverflowPolicy overflow = OverflowPolicy::BLOCK;  // Kebijakan saat antrian penuh
+};
+
+/**
+ * Statistik BatchWorker (snapshot, untuk monitoring/logging).
+ */
+struct BatchWorkerStats {
+    uint64_t enqueued = 0;     // Total item yang berhasil masuk antrian
+    uint64_t processed = 0;    // Total item yang sudah diserahkan ke handler
+    uint64_t dropped = 0;      // Total item yang dibuang (DROP_OLDEST / DROP_NEWEST)
+    uint64_t rejected = 0;     // Total item yang ditolak (REJECT)
+    size_t queue_size = 0;     // Perkiraan isi antrian saat ini
+    size_t capacity = 0;       // Kapasitas antrian
+};
+
+/**
+ * BatchWorker<T> -- Antrian lock-free + thread worker dengan handler batch
+ *
+ * Shutdown: destructor menandai stop, worker menghabiskan sisa antrian,
+ * lalu thread di-join. Item yang sudah diterima tidak hilang.
+ *
+ * @tparam T Tipe item (default-constructible dan move-assignable)
+ */
+template <typename T>
+class BatchWorker {
+public:
+    /// Handler dipanggil dari thread worker dengan 1..max_batch item
+    using Handler = std::function<void(absl::Span<const T>)>;
+
+    /**
+     * @param name    Nama worker untuk logging (contoh: "Pipeline", "Bridge[DDS]")
+     * @param config  Konfigurasi antrian dan thread
+     * @param handler Fungsi pemroses batch
+     */
+    BatchWorker(std::string name, const BatchWorkerConfig& config, Handler handler)
+        : name_(std::move(name)),
+          config_(config),
+          handler_(std::move(handler)),
+          queue_(config.queue_depth) {
+        if (config_.threads == 0) {
+            config_.threads = 1;
+        }
+        if (config_.max_batch == 0) {
+            config_.max_batch = 1;
+        }
+        for (size_t i = 0; i < config_.threads; ++i) {
+            threads_.emplace_back(&BatchWorker::run, this);
+        }
+        spdlog::info("{}: Worker started (queue={}, threads={}, max_batch={}, overflow={})",
+                     name_, queue_.capacity(), config_.threads, config_.max_batch,
+                     utils::overflow_policy_name(config_.overflow));
+    }
+
+    /**
+     * Destructor: stop, habiskan sisa antrian, join semua thread.
+     */
+    ~BatchWorker() {
+        stopping_.store(true, std::memory_order_release);
+        {
+            std::lock_guard<std::mutex> lock(wake_mutex_);
+            wake_cv_.notify_all();
+        }
+        for (auto& t : threads_) {
+            if (t.joinable()) {
+                t.join();
+            }
+        }
+
+        BatchWorkerStats s = stats();
+        spdlog::info("{}: Worker stopped (enqueued={}, processed={}, dropped={}, rejected={})",
+                     name_, s.enqueued, s.processed, s.dropped, s.rejected);
+    }
+
+    BatchWorker(const BatchWorker&) = delete;
+    BatchWorker& operator=(const BatchWorker&) = delete;
+
+    /**
+     * Masukkan satu item ke antrian sesuai overflow policy:
+     *   - BLOCK       : tunggu sampai ada slot (yield, lalu sleep singkat)
+     *   - DROP_OLDEST : buang item terlama, item baru tetap masuk
+     *   - DROP_NEWEST : buang item baru ini (dihitung sebagai dropped)
+     *   - REJECT      : tolak item baru (return false)
+     *
+     * `item` hanya di-move jika benar-benar masuk antrian.
+     * @return false hanya untuk policy REJECT saat antrian penuh
+     */
+    template <typename U>
+    bool push(U&& item) {
+        if (!queue_.try_push(std::forward<U>(item))) {
+            switch (config_.overflow) {
+            case OverflowPolicy::REJECT:
+                rejected_.fetch_add(1, std::memory_order_relaxed);
+                return false;
+
+            case OverflowPolicy::DROP_NEWEST:
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+                wake();
+                return true;
+
+            case OverflowPolicy::DROP_OLDEST: {
+                T discarded;
+                do {
+                    if (queue_.try_pop(discarded)) {
+                        dropped_.fetch_add(1, std::memory_order_relaxed);
+                    }
+                } while (!queue_.try_push(std::forward<U>(item)));
+                break;
+            }
+
+            case OverflowPolicy::BLOCK: {
+                int spins = 0;
+                wake();  // Pastikan worker bangun untuk mengosongkan antrian
+                while (!queue_.try_push(std::forward<U>(item))) {
+                    if (++spins < kBlockSpins) {
+                        std::this_thread::yield();
+                    } else {
+                        std::this_thread::sleep_for(kBlockBackoff);
+                    }
+                }
+                break;
+            }
+            }
+        }
+
+        enqueued_.fetch_add(1, std::memory_order_relaxed);
+        wake();
+        return true;
+    }
+
+    /**
+     * Masukkan banyak item. Untuk policy REJECT, batch ditolak UTUH jika
+     * kapasitas tersisa tidak cukup (dicek di awal, bersifat perkiraan).
+     * @return false jika batch ditolak
+     */
+    bool push_batch(absl::Span<const T> items) {
+        if (config_.overflow == OverflowPolicy::REJECT &&
+            queue_.size_approx() + items.size() > queue_.capacity()) {
+            rejected_.fetch_add(items.size(), std::memory_order_relaxed);
+            return false;
+        }
+        for (const auto& item : items) {
+            if (!push(item)) {
+                return false;  // Hanya mungkin pada REJECT (race dengan producer lain)
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Ambil snapshot statistik.
+     */
+    BatchWorkerStats stats() const {
+        BatchWorkerStats s;
+        s.enqueued = enqueued_.load(std::memory_order_relaxed);
+        s.processed = processed_.load(std::memory_order_relaxed);
+        s.dropped = dropped_.load(std::memory_order_relaxed);
+        s.rejected = rejected_.load(std::memory_order_relaxed);
+        s.queue_size = queue_.size_approx();
+        s.capacity = queue_.capacity();
+        return s;
+    }
+
+    /// Nama worker (untuk logging)
+    const std::string& name() const {
+        return name_;
+    }
+
+private:
+    // Batas waktu tidur worker -- jaring pengaman jika notifikasi terlewat
+    static constexpr std::chrono::milliseconds kIdleWait{10};
+
+    // Jeda producer saat policy BLOCK dan antrian penuh (setelah beberapa kali yield)
+    static constexpr std::chrono::microseconds kBlockBackoff{50};
+    static constexpr int kBlockSpins = 64;
+
+    /**
+     * Bangunkan worker hanya jika ada yang sedang tidur.
+     * Fence seq_cst berpasangan dengan fetch_add di run():
+     * producer melihat idle_ > 0, ATAU worker melihat item baru.
+     */
+    void wake() {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (idle_.load(std::memory_order_relaxed) > 0) {
+            std::lock_guard<std::mutex> lock(wake_mutex_);
+            wake_cv_.notify_one();
+        }
+    }
+
+    /**
+     * Loop thread worker. Buffer batch dialokasikan SEKALI per thread dan
+     * objek T di dalamnya dipakai ulang (try_pop melakukan move-assign).
+     */
+    void run() {
+        std::vector<T> batch(config_.max_batch);
+
+        for (;;) {
+            size_t count = 0;
+            while (count < batch.size() && queue_.try_pop(batch[count])) {
+                ++count;
+            }
+
+            if (count > 0) {
+                handler_(absl::Span<const T>(batch.data(), count));
+                processed_.fetch_add(count, std::memory_order_relaxed);
+                continue;
+            }
+
+            // Antrian kosong: berhenti jika sedang shutdown
+            if (stopping_.load(std::memory_order_acquire)) {
+                break;
+            }
+
+            // Tidur sampai ada item baru (atau timeout sebagai jaring pengaman)
+            std::unique_lock<std::mutex> lock(wake_mutex_);
+            idle_.fetch_add(1, std::memory_order_seq_cst);
+            wake_cv_.wait_for(lock, kIdleWait, [this] {
+                return queue_.size_approx() > 0 || stopping_.load(std::memory_order_acquire);
+            });
+            idle_.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+
+    std::string name_;
+    BatchWorkerConfig config_;
+    Handler handler_;
+
+    BoundedQueue<T> queue_;
+    std::vector<std::thread> threads_;
+
+    std::mutex wake_mutex_;
+    std::condition_variable wake_cv_;
+    std::atomic<int> idle_{0};
+    std::atomic<bool> stopping_{false};
+
+    // Counter statistik
+    std::atomic<uint64_t> enqueued_{0};
+    std::atomic<uint64_t> processed_{0};
+    std::atomic<uint64_t> dropped_{0};
+    std::atomic<uint64_t> rejected_{0};
+};
@@ -0,0 +1,149 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <utility>
+
+/**
+ * BoundedQueue -- Antrian lock-free berkapasitas tetap (multi-producer)
+ *
+ * Implementasi ring buffer dari Dmitry Vyukov ("bounded MPMC queue").
+ * Banyak thread gRPC (producer) bisa push bersamaan, dan satu atau lebih
+ * thread dispatcher (consumer) bisa pop bersamaan -- TANPA mutex.
+ *
+ * Cara kerja singkat:
+ *   - Setiap slot (Cell) punya nomor urut `sequence`.
+ *   - Producer mengklaim posisi dengan compare_exchange pada enqueue_pos_,
+ *     menulis data, lalu menaikkan sequence slot (release) -> slot "terisi".
+ *   - Consumer mengklaim posisi dengan compare_exchange pada dequeue_pos_,
+ *     membaca data, lalu menaikkan sequence slot satu putaran -> slot "kosong".
+ *   - Tidak ada alokasi memori setelah konstruksi: semua slot dialokasikan
+ *     di awal, dan objek T di dalam slot dipakai ulang (move-assign).
+ *
+ * Kapasitas dibulatkan ke atas ke pangkat 2 agar index cukup dihitung
+ * dengan bitmask (pos & mask_), bukan modulo.
+ *
+ * @tparam T Tipe elemen (harus default-constructible dan move-assignable)
+ */
+template <typename T>
+class BoundedQueue {
+public:
+    /**
+     * @param capacity Kapasitas minimum (dibulatkan ke pangkat 2, minimal 2)
+     */
+    explicit BoundedQueue(size_t capacity)
+        : capacity_(round_up_pow2(capacity)),
+          mask_(capacity_ - 1),
+          cells_(new Cell[capacity_]) {
+        for (size_t i = 0; i < capacity_; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        enqueue_pos_.store(0, std::memory_order_relaxed);
+        dequeue_pos_.store(0, std::memory_order_relaxed);
+    }
+
+    BoundedQueue(const BoundedQueue&) = delete;
+    BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+    /**
+     * Coba masukkan elemen. Tidak pernah blocking.
+     * `value` hanya di-move jika push BERHASIL, jadi aman untuk dicoba ulang.
+     * @return true jika berhasil, false jika antrian penuh
+     */
+    template <typename U>
+    bool try_push(U&& value) {
+        Cell* cell;
+        size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &cells_[pos & mask_];
+            size_t seq = cell->sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                // Slot kosong untuk posisi ini -- coba klaim
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;  // Slot masih berisi data putaran sebelumnya -> penuh
+            } else {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);  // Producer lain lebih dulu
+            }
+        }
+        cell->data = std::forward<U>(value);
+        cell->sequence.store(pos + 1, std::memory_order_release);  // Tandai slot terisi
+        return true;
+    }
+
+    /**
+     * Coba ambil elemen terdepan. Tidak pernah blocking.
+     * @param out Tujuan elemen (di-move-assign dari slot)
+     * @return true jika berhasil, false jika antrian kosong
+     */
+    bool try_pop(T& out) {
+        Cell* cell;
+        size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &cells_[pos & mask_];
+            size_t seq = cell->sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+            if (diff == 0) {
+                // Slot terisi untuk posisi ini -- coba klaim
+                if (dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;  // Slot belum diisi producer -> kosong
+            } else {
+                pos = dequeue_pos_.load(std::memory_order_relaxed);  // Consumer lain lebih dulu
+            }
+        }
+        out = std::move(cell->data);
+        cell->sequence.store(pos + mask_ + 1, std::memory_order_release);  // Slot kosong untuk putaran berikutnya
+        return true;
+    }
+
+    /**
+     * Perkiraan jumlah elemen (tidak atomik terhadap push/pop yang sedang berjalan).
+     * Cukup untuk statistik dan keputusan kasar (misalnya cek kapasitas batch).
+     */
+    size_t size_approx() const {
+        size_t enq = enqueue_pos_.load(std::memory_order_acquire);
+        size_t deq = dequeue_pos_.load(std::memory_order_acquire);
+        return enq > deq ? enq - deq : 0;
+    }
+
+    /// Kapasitas sebenarnya (setelah dibulatkan ke pangkat 2)
+    size_t capacity() const {
+        return capacity_;
+    }
+
+private:
+    static size_t round_up_pow2(size_t value) {
+        // Saturasi di pangkat 2 terbesar: tanpa ini result overflow ke 0 (loop tak berujung)
+        constexpr size_t kMaxPow2 = size_t(1) << (std::numeric_limits<size_t>::digits - 1);
+        if (value >= kMaxPow2) {
+            return kMaxPow2;
+        }
+        size_t result = 2;
+        while (result < value) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    /// Satu slot ring buffer. alignas(64) mencegah false sharing antar slot.
+    struct alignas(64) Cell {
+        std::atomic<size_t> sequence;
+        T data;
+    };
+
+    const size_t capacity_;
+    const size_t mask_;
+    std::unique_ptr<Cell[]> cells_;
+
+    // Posisi producer dan consumer di cache line berbeda (hindari false sharing)
+    alignas(64) std::atomic<size_t> enqueue_pos_;
+    alignas(64) std::atomic<size_t> dequeue_pos_;
+};
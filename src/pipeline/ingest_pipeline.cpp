@@ -0,0 +1,59 @@
+/**
+ * ingest_pipeline.cpp -- Implementasi IngestPipeline
+ *
+ * Producer (thread gRPC):
+ *   submit() -> BatchWorker::push() sesuai overflow policy
+ *
+ * Consumer (thread dispatcher milik BatchWorker):
+ *   dispatch() -> notify_observers_batch() + broadcast_sensor_batch()
+ */
+#include "ingest_pipeline.h"
+#include "adapters/service_adapters/bridge_manager.h"
+
+namespace {
+/**
+ * Konversi IngestPipelineConfig ke konfigurasi BatchWorker.
+ */
+BatchWorkerConfig to_worker_config(const IngestPipelineConfig& config) {
+    BatchWorkerConfig worker_config;
+    worker_config.queue_depth = config.queue_depth;
+    worker_config.threads = config.dispatcher_threads;
+    worker_config.max_batch = config.max_batch;
+    worker_config.overflow = config.overflow;
+    return worker_config;
+}
+}  // namespace
+
+/**
+ * Constructor: alokasikan antrian dan jalankan thread dispatcher.
+ */
+IngestPipeline::IngestPipeline(IObservable& observable,
+                               std::shared_ptr<BridgeManager> bridge,
+                               const IngestPipelineConfig& config)
+    : observable_(observable),
+      bridge_(bridge),
+      worker_("Pipeline", to_worker_config(config),
+              [this](absl::Span<const SensorSample> batch) { dispatch(batch); }) {
+}
+
+bool IngestPipeline::submit(const SensorSample& sample) {
+    return worker_.push(sample);
+}
+
+bool IngestPipeline::submit_batch(absl::Span<const SensorSample> batch) {
+    return worker_.push_batch(batch);
+}
+
+/**
+ * OBSERVER + BRIDGE: satu kali dispatch untuk seluruh batch.
+ */
+void IngestPipeline::dispatch(absl::Span<const SensorSample> batch) {
+    observable_.notify_observers_batch(batch);
+    if (bridge_) {
+        bridge_->broadcast_sensor_batch(batch);
+    }
+}
+
+IngestPipelineStats IngestPipeline::stats() const {
+    return worker_.stats();
+}
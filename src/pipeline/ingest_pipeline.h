@@ -0,0 +1,102 @@
+/**
+ * ingest_pipeline.h -- Definisi class IngestPipeline
+ *
+ * File ini mendefinisikan pipeline bertahap (staged) antara controller gRPC
+ * dan observer/BridgeManager:
+ *
+ *   Thread gRPC (banyak)           Thread dispatcher (INGEST_DISPATCHERS)
+ *   --------------------           --------------------------------------
+ *   SensorController::Xxx()
+ *       -> pipeline->submit() --> [BoundedQueue] --> drain sampai max_batch
+ *       <- return langsung                              -> notify_observers_batch()
+ *                                                       -> broadcast_sensor_batch()
+ *
+ * Dengan ini latency request gRPC TIDAK lagi termasuk waktu tulis DDS dan
+ * fan-out WebSocket -- handler hanya memasukkan data ke antrian lalu return.
+ */
+#pragma once
+#include "pipeline/batch_worker.h"
+#include "pipeline/overflow_policy.h"
+#include "adapters/abstract_adapters/observable/interface_observable.h"
+#include "pipeline/sensor_sample.h"
+#include <absl/types/span.h>
+#include <memory>
+
+// Forward declaration -- cukup shared_ptr ke BridgeManager
+class BridgeManager;
+
+/**
+ * Konfigurasi IngestPipeline (dibaca dari environment variable di app.cpp).
+ */
+struct IngestPipelineConfig {
+    bool enabled = true;                              // false: proses inline di thread gRPC
+    size_t queue_depth = 8192;                        // Kapasitas antrian (dibulatkan ke pangkat 2)
+    size_t dispatcher_threads = 1;                    // Jumlah thread dispatcher
+    size_t max_batch = 256;                           // Maksimal data per dispatch
+    OverflowPolicy overflow = OverflowPolicy::BLOCK;  // Kebijakan saat antrian penuh
+};
+
+/// Statistik IngestPipeline -- sama dengan statistik BatchWorker di bawahnya
+using IngestPipelineStats = BatchWorkerStats;
+
+/**
+ * IngestPipeline -- Antrian + dispatcher antara controller dan observer/bridge
+ *
+ * Antrian, thread dispatcher, overflow policy, dan shutdown ditangani oleh
+ * BatchWorker; class ini hanya menentukan apa yang dilakukan per batch.
+ *
+ * Urutan data:
+ *   - Dengan 1 dispatcher (default), urutan data dipertahankan persis.
+ *   - Dengan >1 dispatcher, throughput naik tetapi urutan antar-batch
+ *     tidak lagi dijamin (observer harus thread-safe, dan Observable sudah).
+ *
+ * Shutdown:
+ *   - Destructor menandai stop, dispatcher menghabiskan sisa antrian,
+ *     lalu thread di-join. Tidak ada data yang sudah diterima yang hilang.
+ */
+class IngestPipeline {
+public:
+    /**
+     * @param observable Target notify (biasanya controller pemilik pipeline ini)
+     * @param bridge     BridgeManager untuk broadcast (boleh null)
+     * @param config     Konfigurasi antrian dan dispatcher
+     */
+    IngestPipeline(IObservable& observable,
+                   std::shared_ptr<BridgeManager> bridge,
+                   const IngestPipelineConfig& config);
+
+    IngestPipeline(const IngestPipeline&) = delete;
+    IngestPipeline& operator=(const IngestPipeline&) = delete;
+
+    /**
+     * Masukkan satu data sensor ke antrian.
+     * @return false jika ditolak (policy REJECT dan antrian penuh)
+     */
+    bool submit(const SensorSample& sample);
+
+    /**
+     * Masukkan satu batch data sensor ke antrian.
+     * Untuk policy REJECT, batch ditolak UTUH jika kapasitas tersisa
+     * tidak cukup (dicek di awal, bersifat perkiraan).
+     * @return false jika batch ditolak
+     */
+    bool submit_batch(absl::Span<const SensorSample> batch);
+
+    /**
+     * Ambil snapshot statistik pipeline.
+     */
+    IngestPipelineStats stats() const;
+
+private:
+    /**
+     * Dipanggil dari thread dispatcher untuk setiap batch.
+     */
+    void dispatch(absl::Span<const SensorSample> batch);
+
+    IObservable& observable_;                 // Target notify_observers_batch()
+    std::shared_ptr<BridgeManager> bridge_;   // Target broadcast_sensor_batch()
+
+    // Dideklarasikan TERAKHIR: thread dispatcher berhenti (destructor worker)
+    // sebelum observable_/bridge_ tidak valid lagi.
+    BatchWorker<SensorSample> worker_;
+};
@@ -0,0 +1,100 @@
+#pragma once
+#include "pipeline/sensor_sample.h"
+#include <absl/container/flat_hash_map.h>
+#include <absl/types/span.h>
+#include <mutex>
+#include <vector>
+
+/**
+ * latest_value_table.h -- Tabel nilai TERBARU per sensor (conflation)
+ *
+ * Dashboard hanya menampilkan nilai saat ini setiap sensor. Jika sensor
+ * mengirim 1000 data/detik tetapi dashboard di-refresh 20 kali/detik,
+ * 980 data di antaranya tidak pernah terlihat. Tabel ini menyimpan hanya
+ * data terbaru per sensor_id dan menandai sensor yang berubah (dirty):
+ *
+ *   upsert(sample)       -> timpa nilai sensor, tandai dirty
+ *   take_dirty(out)      -> ambil semua sensor yang berubah sejak panggilan
+ *                           sebelumnya, lalu bersihkan tanda dirty
+ *
+ * Laju keluar dibatasi oleh frekuensi take_dirty() (tick), bukan oleh
+ * laju data masuk: maksimal satu data per sensor per tick.
+ *
+ * Thread-safety: satu mutex; upsert_batch() mengambilnya sekali per batch.
+ */
+class LatestValueTable {
+public:
+    /**
+     * Simpan data terbaru satu sensor.
+     */
+    void upsert(const SensorSample& sample) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        upsert_locked(sample);
+    }
+
+    /**
+     * Simpan data terbaru untuk banyak sensor (satu lock per batch).
+     * Jika satu sensor muncul beberapa kali, yang terakhir yang disimpan.
+     */
+    void upsert_batch(absl::Span<const SensorSample> batch) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& sample : batch) {
+            upsert_locked(sample);
+        }
+    }
+
+    /**
+     * Salin semua sensor yang berubah ke `out` (urutan = urutan pertama kali
+     * berubah), lalu bersihkan tanda dirty.
+     * @param out [out] Dikosongkan lalu diisi data terbaru
+     */
+    void take_dirty(std::vector<SensorSample>& out) {
+        out.clear();
+        std::lock_guard<std::mutex> lock(mutex_);
+        out.reserve(dirty_.size());
+        for (int32_t sensor_id : dirty_) {
+            Entry& entry = entries_[sensor_id];
+            out.push_back(entry.sample);
+            entry.dirty = false;
+        }
+        dirty_.clear();
+    }
+
+    /**
+     * Salin nilai terbaru SEMUA sensor yang pernah terlihat (tanpa mengubah dirty).
+     * @param out [out] Dikosongkan lalu diisi data terbaru
+     */
+    void snapshot(std::vector<SensorSample>& out) const {
+        out.clear();
+        std::lock_guard<std::mutex> lock(mutex_);
+        out.reserve(entries_.size());
+        for (const auto& entry : entries_) {
+            out.push_back(entry.second.sample);
+        }
+    }
+
+    /// Jumlah sensor yang tercatat
+    size_t size() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return entries_.size();
+    }
+
+private:
+    struct Entry {
+        SensorSample sample;
+        bool dirty = false;
+    };
+
+    void upsert_locked(const SensorSample& sample) {
+        Entry& entry = entries_[sample.sensor_id];
+        entry.sample = sample;
+        if (!entry.dirty) {
+            entry.dirty = true;
+            dirty_.push_back(sample.sensor_id);
+        }
+    }
+
+    mutable std::mutex mutex_;
+    absl::flat_hash_map<int32_t, Entry> entries_;  // sensor_id -> data terbaru
+    std::vector<int32_t> dirty_;                   // sensor_id yang berubah sejak take_dirty() terakhir
+};
@@ -0,0 +1,61 @@
+#pragma once
+#include <string>
+
+/**
+ * overflow_policy.h -- Kebijakan saat antrian (queue) penuh
+ *
+ * Dipakai oleh IngestPipeline (antara SensorController dan BridgeManager)
+ * dan oleh antrian per-adapter di BridgeManager. Producer lebih cepat dari
+ * consumer hanya sementara -- tetapi jika berlangsung lama, antrian penuh
+ * dan kita harus memilih: menunggu, membuang data, atau menolak data baru.
+ *
+ * Nilai dari environment variable (lihat app.cpp):
+ *   - "block"       : producer menunggu sampai ada slot kosong (tidak ada data hilang)
+ *   - "drop_oldest" : buang data TERLAMA di antrian, data baru tetap masuk
+ *   - "drop_newest" : buang data BARU tanpa memberi tahu producer
+ *   - "reject"      : tolak data baru; controller membalas RESOURCE_EXHAUSTED
+ */
+enum class OverflowPolicy {
+    BLOCK,        // Tunggu sampai antrian punya slot kosong
+    DROP_OLDEST,  // Buang data terlama agar data terbaru bisa masuk
+    DROP_NEWEST,  // Buang data baru, isi antrian tidak berubah
+    REJECT        // Tolak data baru (gRPC: RESOURCE_EXHAUSTED)
+};
+
+namespace utils {
+    /**
+     * Parse string menjadi OverflowPolicy.
+     *
+     * @param policy   String nama policy ("block", "drop_oldest", "drop_newest", "reject")
+     * @param fallback Policy default jika string tidak dikenali
+     * @return OverflowPolicy yang sesuai
+     */
+    inline OverflowPolicy parse_overflow_policy(const std::string& policy, OverflowPolicy fallback) {
+        if (policy == "block") {
+            return OverflowPolicy::BLOCK;
+        }
+        if (policy == "drop_oldest") {
+            return OverflowPolicy::DROP_OLDEST;
+        }
+        if (policy == "drop_newest") {
+            return OverflowPolicy::DROP_NEWEST;
+        }
+        if (policy == "reject") {
+            return OverflowPolicy::REJECT;
+        }
+        return fallback;
+    }
+
+    /**
+     * Nama policy untuk logging.
+     */
+    inline const char* overflow_policy_name(OverflowPolicy policy) {
+        switch (policy) {
+        case OverflowPolicy::BLOCK:       return "block";
+        case OverflowPolicy::DROP_OLDEST: return "drop_oldest";
+        case OverflowPolicy::DROP_NEWEST: return "drop_newest";
+        case OverflowPolicy::REJECT:      return "reject";
+        }
+        return "unknown";
+    }
+}
@@ -0,0 +1,135 @@
+#pragma once
+#include "utils/string_interner.h"
+#include "sensor.pb.h"
+#include "sensor_fields.h"
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+/**
+ * sensor_sample.h -- Representasi internal satu data sensor
+ *
+ * iot::SensorRequest (protobuf) membawa dua std::string di heap
+ * (sensor_name, location) dan overhead objek protobuf. Di dalam proses,
+ * setiap data melewati antrian, observer, dan beberapa adapter -- jadi
+ * setiap copy/move SensorRequest berarti alokasi dan pointer chasing.
+ *
+ * SensorSample adalah POD berukuran tetap, tepat SATU cache line (64 byte):
+ *   - semua field numerik disimpan langsung
+ *   - string diganti ID dari utils::StringInterner::global()
+ *
+ * Konversi ke/dari format wire hanya terjadi di TEPI sistem:
+ *   gRPC (SensorRequest/SensorBatch) -> to_sample()   -> pipeline internal
+ *   pipeline internal -> JSON (WebSocket) / Messengger::Message (DDS)
+ *
+ * Field mengikuti message SensorRequest (tabel IOT_SENSOR_REQUEST_FIELDS
+ * di sensor_fields.h, di-generate dari sensor.proto saat build):
+ *   - field numerik <name> -> member <name> dengan tipe C++ yang sama
+ *   - field string  <name> -> member <name>_id + accessor <name>()
+ * Field baru di .proto cukup ditambahkan sebagai member di sini; konversi
+ * dan serializer JSON mengikutinya otomatis.
+ */
+struct alignas(64) SensorSample {
+    int64_t timestamp = 0;           // Epoch milliseconds
+    double temperature = 0.0;        // Celsius
+    double humidity = 0.0;           // Persen
+    double pressure = 0.0;           // hPa
+    double light_intensity = 0.0;    // Lux
+    int32_t sensor_id = 0;
+    uint32_t sensor_name_id = utils::StringInterner::kEmpty;  // ID di StringInterner
+    uint32_t location_id = utils::StringInterner::kEmpty;     // ID di StringInterner
+
+    /// Nama sensor (referensi stabil ke tabel intern)
+    const std::string& sensor_name() const {
+        return utils::StringInterner::global().resolve(sensor_name_id);
+    }
+
+    /// Lokasi sensor (referensi stabil ke tabel intern)
+    const std::string& location() const {
+        return utils::StringInterner::global().resolve(location_id);
+    }
+};
+
+static_assert(sizeof(SensorSample) == 64, "SensorSample harus tepat satu cache line");
+static_assert(std::is_trivially_copyable<SensorSample>::value,
+              "SensorSample harus trivially copyable (disalin apa adanya antar antrian)");
+
+// Setiap field SensorRequest harus punya padanan di SensorSample
+#define IOT_SAMPLE_CHECK_SCALAR(type, name, tag)                                   \
+    static_assert(std::is_same<decltype(SensorSample::name), type>::value,        \
+                  "SensorSample::" #name " harus bertipe sama dengan SensorRequest." #name);
+#define IOT_SAMPLE_CHECK_STRING(name, tag)                                         \
+    static_assert(std::is_same<decltype(SensorSample::name##_id), uint32_t>::value, \
+                  "SensorSample::" #name "_id harus berisi ID StringInterner");
+IOT_SENSOR_REQUEST_FIELDS(IOT_SAMPLE_CHECK_SCALAR, IOT_SAMPLE_CHECK_STRING)
+#undef IOT_SAMPLE_CHECK_SCALAR
+#undef IOT_SAMPLE_CHECK_STRING
+
+namespace utils {
+    /// Hasil konversi input client (to_sample / decode_sensor_batch)
+    enum class ConvertStatus {
+        OK,
+        INVALID,    // Input tidak valid (termasuk string > StringInterner::kMaxLength)
+        EXHAUSTED   // Tabel StringInterner penuh, string baru tidak bisa disimpan
+    };
+
+    /**
+     * Intern satu field string dari client.
+     * @param field Nama field (untuk pesan error)
+     * @param id    [out] ID intern
+     * @param error Diisi pesan error jika gagal
+     */
+    inline ConvertStatus intern_field(const char* field, absl::string_view value,
+                                      StringInterner::Id& id, std::string& error) {
+        switch (StringInterner::global().try_intern(value, id)) {
+            case StringInterner::Result::OK:
+                return ConvertStatus::OK;
+            case StringInterner::Result::TOO_LONG:
+                error = std::string(field) + " longer than " +
+                        std::to_string(StringInterner::kMaxLength) + " bytes";
+                return ConvertStatus::INVALID;
+            case StringInterner::Result::FULL:
+                error = std::string("String table full, cannot register new ") + field;
+                return ConvertStatus::EXHAUSTED;
+        }
+        return ConvertStatus::INVALID;
+    }
+
+    /**
+     * Konversi SensorRequest (gRPC) menjadi SensorSample.
+     * String di-intern; untuk sensor yang sudah dikenal hanya berupa lookup.
+     * String yang tidak bisa di-intern membuat request ditolak (bukan
+     * diam-diam menjadi "").
+     *
+     * @param sample [out] Hasil konversi (hanya valid jika OK)
+     * @param error  Diisi pesan error jika gagal
+     */
+    inline ConvertStatus to_sample(const iot::SensorRequest& request, SensorSample& sample,
+                                   std::string& error) {
+        sample = SensorSample{};
+#define IOT_TO_SAMPLE_SCALAR(type, name, tag) sample.name = request.name();
+#define IOT_TO_SAMPLE_STRING(name, tag)                                                     \
+        {                                                                                   \
+            ConvertStatus status = intern_field(#name, request.name(), sample.name##_id, error); \
+            if (status != ConvertStatus::OK) {                                              \
+                return status;                                                              \
+            }                                                                               \
+        }
+        IOT_SENSOR_REQUEST_FIELDS(IOT_TO_SAMPLE_SCALAR, IOT_TO_SAMPLE_STRING)
+#undef IOT_TO_SAMPLE_SCALAR
+#undef IOT_TO_SAMPLE_STRING
+        return ConvertStatus::OK;
+    }
+
+    /**
+     * Konversi SensorSample kembali ke SensorRequest (untuk transport yang
+     * membutuhkan pesan protobuf).
+     */
+    inline void to_request(const SensorSample& sample, iot::SensorRequest* request) {
+#define IOT_TO_REQUEST_SCALAR(type, name, tag) request->set_##name(sample.name);
+#define IOT_TO_REQUEST_STRING(name, tag) request->set_##name(sample.name());
+        IOT_SENSOR_REQUEST_FIELDS(IOT_TO_REQUEST_SCALAR, IOT_TO_REQUEST_STRING)
+#undef IOT_TO_REQUEST_SCALAR
+#undef IOT_TO_REQUEST_STRING
+    }
+}
@@ -0,0 +1,47 @@
+/**
+ * stats_reporter.cpp -- Implementasi StatsReporter
+ *
+ * Jadwal laporan memakai steady_clock absolut (next += interval), jadi
+ * laporan tidak bergeser walaupun fungsi laporan memakan waktu.
+ */
+#include "stats_reporter.h"
+
+StatsReporter::StatsReporter(std::chrono::seconds interval, std::vector<Report> reports)
+    : interval_(interval), reports_(std::move(reports)) {
+    if (interval_.count() > 0 && !reports_.empty()) {
+        thread_ = std::thread(&StatsReporter::run, this);
+    }
+}
+
+StatsReporter::~StatsReporter() {
+    if (!thread_.joinable()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(stop_mutex_);
+        stopping_ = true;
+    }
+    stop_cv_.notify_all();
+    thread_.join();
+    report_all();  // Counter akhir (data sejak laporan terakhir)
+}
+
+void StatsReporter::run() {
+    auto next = std::chrono::steady_clock::now() + interval_;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(stop_mutex_);
+            if (stop_cv_.wait_until(lock, next, [this] { return stopping_; })) {
+                return;
+            }
+        }
+        report_all();
+        next += interval_;
+    }
+}
+
+void StatsReporter::report_all() {
+    for (const auto& report : reports_) {
+        report();
+    }
+}
@@ -0,0 +1,54 @@
+#pragma once
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * StatsReporter -- Thread yang menjalankan fungsi laporan secara berkala
+ *
+ * Counter antrian (IngestPipeline::stats(), BridgeManager::adapter_stats())
+ * hanya berguna jika ada yang membacanya. StatsReporter memanggil setiap
+ * fungsi laporan sekali per interval; fungsi itulah yang menulis log
+ * (lihat start_stats_reporter() di app.cpp).
+ *
+ * Daftar laporan ditetapkan di constructor dan tidak berubah, jadi thread
+ * reporter tidak perlu lock untuk membacanya. Objek yang dibaca laporan
+ * harus hidup lebih lama dari StatsReporter.
+ */
+class StatsReporter {
+public:
+    using Report = std::function<void()>;
+
+    /**
+     * @param interval Jarak antar laporan; <= 0 berarti nonaktif (tanpa thread)
+     * @param reports  Fungsi laporan, dipanggil berurutan dari thread reporter
+     */
+    StatsReporter(std::chrono::seconds interval, std::vector<Report> reports);
+
+    /**
+     * Destructor: hentikan thread lalu jalankan laporan terakhir.
+     */
+    ~StatsReporter();
+
+    StatsReporter(const StatsReporter&) = delete;
+    StatsReporter& operator=(const StatsReporter&) = delete;
+
+private:
+    /**
+     * Loop thread reporter: tunggu interval (atau stop), lalu jalankan laporan.
+     */
+    void run();
+
+    /// Jalankan semua fungsi laporan
+    void report_all();
+
+    std::chrono::seconds interval_;
+    std::vector<Report> reports_;
+    std::thread thread_;
+    std::mutex stop_mutex_;
+    std::condition_variable stop_cv_;
+    bool stopping_ = false;  // Dilindungi stop_mutex_
+};
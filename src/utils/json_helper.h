@@ -1,14 +1,19 @@
 #pragma once
-#include <rapidjson/document.h>
 #include <rapidjson/writer.h>
 #include <rapidjson/stringbuffer.h>
-#include "sensor.pb.h"
+#include "pipeline/sensor_sample.h"
+#include "sensor_fields.h"
+#include <absl/types/span.h>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <string_view>
 
 /**
  * json_helper.h -- Utility untuk konversi data sensor ke format JSON
  * 
- * File ini menyediakan fungsi helper untuk mengubah SensorRequest (protobuf)
- * menjadi string JSON. JSON digunakan karena:
+ * File ini menyediakan fungsi helper untuk mengubah SensorSample (representasi
+ * internal data sensor) menjadi string JSON. JSON digunakan karena:
  *   - Universal: semua bahasa pemrograman bisa parse JSON
  *   - Human-readable: mudah dibaca saat debugging
  *   - WebSocket standard: browser/frontend mengharapkan data dalam format JSON
@@ -16,46 +21,169 @@
  * Library yang digunakan: RapidJSON
  *   - Salah satu library JSON C++ tercepat
  *   - Header-only (tidak perlu compile library terpisah)
- *   - Menggunakan DOM (Document Object Model) approach
+ *   - Menggunakan Writer (SAX / streaming) -- TANPA membangun DOM:
+ *     setiap field langsung ditulis ke buffer output
  * 
  * Fungsi ini dipanggil oleh WebSocketAdapter::send() sebelum broadcast.
  */
 namespace utils {
     /**
-     * Konversi SensorRequest (protobuf) menjadi JSON string.
+     * Encoder JSON streaming milik satu thread.
      * 
-     * Proses:
-     *   1. Buat RapidJSON Document (representasi JSON di memory)
-     *   2. Tambahkan field sensor satu per satu ke document
-     *   3. Serialize document ke string menggunakan RapidJSON Writer
+     * Buffer dan Writer (termasuk stack level object-nya) dibuat sekali per
+     * thread lalu dipakai ulang: setelah beberapa data pertama, encode tidak
+     * lagi mengalokasi memori. Double diformat oleh RapidJSON (Grisu2):
+     * representasi terpendek yang di-parse kembali ke nilai yang sama.
+     */
+    struct JsonEncoder {
+        rapidjson::StringBuffer buffer;
+        rapidjson::Writer<rapidjson::StringBuffer> writer;
+
+        JsonEncoder() : writer(buffer) {}
+
+        /// Encoder thread ini
+        static JsonEncoder& local() {
+            thread_local JsonEncoder encoder;
+            return encoder;
+        }
+
+        /// Kosongkan buffer dan state writer (kapasitas tetap dipakai ulang)
+        void reset() {
+            buffer.Clear();
+            writer.Reset(buffer);
+        }
+
+        /// Key object (literal, panjang dihitung saat compile)
+        template <size_t N>
+        void key(const char (&name)[N]) {
+            writer.Key(name, static_cast<rapidjson::SizeType>(N - 1));
+        }
+
+        /// Double; NaN/Inf tidak valid di JSON sehingga ditulis null
+        void number(double value) {
+            if (std::isfinite(value)) {
+                writer.Double(value);
+            } else {
+                writer.Null();
+            }
+        }
+
+        void number(int32_t value) {
+            writer.Int(value);
+        }
+
+        void number(int64_t value) {
+            writer.Int64(value);
+        }
+
+        void number(uint32_t value) {
+            writer.Uint(value);
+        }
+
+        void number(uint64_t value) {
+            writer.Uint64(value);
+        }
+
+        void number(float value) {
+            number(static_cast<double>(value));
+        }
+
+        void number(bool value) {
+            writer.Bool(value);
+        }
+
+        void string(const std::string& value) {
+            writer.String(value.data(), static_cast<rapidjson::SizeType>(value.size()));
+        }
+
+        /// Hasil encode (valid sampai encode berikutnya di thread ini)
+        std::string_view view() const {
+            return std::string_view(buffer.GetString(), buffer.GetSize());
+        }
+    };
+
+    /**
+     * Tulis SensorSample sebagai JSON object ke encoder (tanpa reset).
+     * 
+     * SEMUA field SensorRequest ditulis, dengan key = nama field dan urutan
+     * sesuai sensor.proto. Daftar field berasal dari IOT_SENSOR_REQUEST_FIELDS
+     * (di-generate dari sensor.proto saat build) dan di-expand saat compile:
+     * hasilnya sama dengan kode tulisan tangan, tanpa reflection protobuf.
      * 
      * Contoh output:
-     *   {"sensor_id":1,"temperature":25.5,"humidity":60.0,"location":"Room A"}
+     *   {"sensor_id":1,"sensor_name":"DHT22","temperature":25.5,"humidity":60.0,
+     *    "pressure":1013.2,"light_intensity":300.0,"timestamp":1700000000000,
+     *    "location":"Room A"}
      * 
-     * Catatan: tidak semua field SensorRequest dikonversi ke JSON.
-     * Hanya field yang diperlukan oleh frontend yang disertakan.
+     * String di-resolve dari StringInterner dan ditulis langsung (tanpa copy).
+     */
+    inline void write_sensor_json(JsonEncoder& encoder, const SensorSample& sample) {
+        encoder.writer.StartObject();
+#define IOT_JSON_SCALAR(type, name, tag) \
+        encoder.key(#name);                 \
+        encoder.number(sample.name);
+#define IOT_JSON_STRING(name, tag) \
+        encoder.key(#name);           \
+        encoder.string(sample.name());
+        IOT_SENSOR_REQUEST_FIELDS(IOT_JSON_SCALAR, IOT_JSON_STRING)
+#undef IOT_JSON_SCALAR
+#undef IOT_JSON_STRING
+        encoder.writer.EndObject();
+    }
+
+    /**
+     * Konversi SensorSample menjadi JSON, hasil berupa view ke buffer
+     * thread-local (tanpa alokasi). View hanya valid sampai pemanggilan
+     * encode berikutnya di thread yang sama -- salin jika perlu disimpan.
+     */
+    inline std::string_view sensor_to_json_view(const SensorSample& sample) {
+        JsonEncoder& encoder = JsonEncoder::local();
+        encoder.reset();
+        write_sensor_json(encoder, sample);
+        return encoder.view();
+    }
+
+    /**
+     * Konversi SensorSample menjadi JSON string.
      * 
-     * @param request Pointer ke SensorRequest (data sensor dari gRPC)
+     * Proses:
+     *   1. Tulis field satu per satu ke buffer thread-local (streaming Writer)
+     *   2. Salin hasilnya SEKALI ke std::string milik pemanggil
+     * 
+     * @param sample Data sensor
      * @return String JSON yang siap dikirim via WebSocket
      */
-    inline std::string sensor_to_json(const iot::SensorRequest* request) {
-        // Buat JSON document kosong bertipe Object {}
-        rapidjson::Document doc;
-        doc.SetObject();
-        rapidjson::Document::AllocatorType& allocator = doc.GetAllocator();  // Allocator untuk memory management
-
-        // Tambahkan field-field sensor ke JSON document
-        doc.AddMember("sensor_id", request->sensor_id(), allocator);         // integer
-        doc.AddMember("temperature", request->temperature(), allocator);     // double
-        doc.AddMember("humidity", request->humidity(), allocator);           // double
-        // String harus di-wrap dengan rapidjson::Value agar memory di-manage oleh allocator
-        doc.AddMember("location", rapidjson::Value(request->location().c_str(), allocator).Move(), allocator);
-
-        // Serialize JSON document ke string
-        rapidjson::StringBuffer buffer;                         // Buffer untuk menampung output
-        rapidjson::Writer<rapidjson::StringBuffer> writer(buffer); // Writer yang menulis ke buffer
-        doc.Accept(writer);                                     // Traverse document dan tulis ke buffer
-
-        return buffer.GetString();  // Kembalikan sebagai std::string
+    inline std::string sensor_to_json(const SensorSample& sample) {
+        return std::string(sensor_to_json_view(sample));
+    }
+
+    /**
+     * Gabungkan beberapa JSON object (hasil sensor_to_json) menjadi satu
+     * JSON array, tanpa parse ulang: "[" + a + "," + b + ... + "]".
+     * Dipakai untuk frame micro-batch WebSocket.
+     * 
+     * @param items   JSON object yang sudah diserialisasi
+     * @param indices Posisi item yang disertakan (urut); semua item jika kosong
+     * @return String JSON array, contoh: [{"sensor_id":1,...},{"sensor_id":2,...}]
+     */
+    inline std::string join_json_array(absl::Span<const std::string> items,
+                                       absl::Span<const uint32_t> indices = {}) {
+        size_t count = indices.empty() ? items.size() : indices.size();
+        size_t length = 2 + count;  // "[" + "]" + koma
+        for (size_t i = 0; i < count; ++i) {
+            length += items[indices.empty() ? i : indices[i]].size();
+        }
+
+        std::string out;
+        out.reserve(length);  // Satu alokasi untuk seluruh array
+        out.push_back('[');
+        for (size_t i = 0; i < count; ++i) {
+            if (i > 0) {
+                out.push_back(',');
+            }
+            out.append(items[indices.empty() ? i : indices[i]]);
+        }
+        out.push_back(']');
+        return out;
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,249 @@
+/**
+ * binary_journal.cpp -- Implementasi BinaryJournal (lihat binary_journal.h)
+ *
+ * I/O: POSIX open/posix_fallocate/mmap (Linux)
+ */
+#include "binary_journal.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <vector>
+#include <spdlog/spdlog.h>
+
+namespace {
+int64_t unix_now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+}  // namespace
+
+BinaryJournal::BinaryJournal(const BinaryJournalConfig& config) : config_(config) {
+    // Minimal 64 KiB; record yang tetap tidak muat di file baru dihitung dropped
+    config_.file_bytes = journal::aligned(std::max<size_t>(config_.file_bytes, 64 * 1024));
+    config_.max_files = std::max<size_t>(config_.max_files, 1);
+    start_ms_ = unix_now_ns() / 1000000;
+}
+
+BinaryJournal::~BinaryJournal() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    close_file_locked();
+    spdlog::info("[Journal] Closed (written={}, dropped={}, rotations={})",
+                 written(), dropped(), rotations_.load(std::memory_order_relaxed));
+}
+
+bool BinaryJournal::open() {
+    std::error_code error;
+    std::filesystem::create_directories(config_.directory, error);
+    if (error) {
+        spdlog::error("[Journal] Cannot create directory '{}': {}", config_.directory, error.message());
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    scan_existing_files_locked();
+    if (!open_file_locked()) {
+        return false;
+    }
+    spdlog::info("[Journal] Writing to {} (file={} bytes, max_files={})",
+                 config_.directory, config_.file_bytes, config_.max_files);
+    return true;
+}
+
+/**
+ * Buka file baru berukuran penuh lalu map ke memori.
+ *
+ * Proses:
+ *   1. Buat file dan alokasikan file_bytes (posix_fallocate, isi nol;
+ *      ftruncate hanya jika filesystem tidak mendukung fallocate).
+ *      Gagal alokasi = gagal buka: data berikutnya dihitung dropped.
+ *   2. mmap MAP_SHARED seluruh file
+ *   3. Tulis FileHeader; sisa file (nol) = record END
+ */
+bool BinaryJournal::open_file_locked() {
+    char name[64];
+    std::snprintf(name, sizeof(name), "iot-journal-%lld-%06llu.bin",
+                  static_cast<long long>(start_ms_), static_cast<unsigned long long>(sequence_));
+    path_ = (std::filesystem::path(config_.directory) / name).string();
+
+    fd_ = ::open(path_.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd_ < 0) {
+        spdlog::error("[Journal] Cannot open {}: {}", path_, std::strerror(errno));
+        return false;
+    }
+    int ret = ::posix_fallocate(fd_, 0, static_cast<off_t>(config_.file_bytes));
+    if (ret == EOPNOTSUPP || ret == EINVAL) {
+        // Filesystem tanpa fallocate: file sparse, blok dialokasikan saat ditulis
+        ret = ::ftruncate(fd_, static_cast<off_t>(config_.file_bytes)) == 0 ? 0 : errno;
+    }
+    if (ret != 0) {
+        // ENOSPC/EIO dll.: jangan map file yang bisa SIGBUS saat ditulis
+        spdlog::error("[Journal] Cannot allocate {}: {}", path_, std::strerror(ret));
+        ::close(fd_);
+        fd_ = -1;
+        ::unlink(path_.c_str());
+        return false;
+    }
+    void* mapping = ::mmap(nullptr, config_.file_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    if (mapping == MAP_FAILED) {
+        spdlog::error("[Journal] Cannot map {}: {}", path_, std::strerror(errno));
+        ::close(fd_);
+        fd_ = -1;
+        return false;
+    }
+    base_ = static_cast<char*>(mapping);
+
+    journal::FileHeader header{};
+    std::memcpy(header.magic, journal::kMagic, sizeof(header.magic));
+    header.version = journal::kVersion;
+    header.sensor_args_size = static_cast<uint32_t>(sizeof(journal::SensorArgs));
+    header.created_unix_ns = unix_now_ns();
+    header.sequence = sequence_++;
+    std::memcpy(base_, &header, sizeof(header));
+    offset_ = sizeof(header);
+    defined_.clear();
+    return true;
+}
+
+/**
+ * Tutup file saat ini: potong ke ukuran terpakai, lalu hapus file terlama
+ * jika jumlah file melebihi max_files.
+ */
+void BinaryJournal::close_file_locked() {
+    if (!base_) {
+        return;
+    }
+    ::msync(base_, offset_, MS_ASYNC);
+    ::munmap(base_, config_.file_bytes);
+    base_ = nullptr;
+    if (::ftruncate(fd_, static_cast<off_t>(offset_)) != 0) {
+        spdlog::warn("[Journal] Cannot truncate {}: {}", path_, std::strerror(errno));
+    }
+    ::close(fd_);
+    fd_ = -1;
+
+    files_.push_back(path_);
+    prune_files_locked();
+}
+
+void BinaryJournal::prune_files_locked() {
+    while (files_.size() > config_.max_files) {
+        std::error_code error;
+        std::filesystem::remove(files_.front(), error);
+        files_.pop_front();
+    }
+}
+
+/**
+ * File dari run sebelumnya ikut dihitung retensi; tanpa ini setiap restart
+ * menambah max_files file baru dan folder tumbuh tanpa batas.
+ *
+ * Urutan = urutan nama: iot-journal-<start_ms>-<sequence 6 digit>.bin,
+ * start_ms berjumlah digit sama (13) sampai tahun 2286.
+ */
+void BinaryJournal::scan_existing_files_locked() {
+    std::vector<std::string> existing;
+    std::error_code error;
+    for (std::filesystem::directory_iterator it(config_.directory, error), end; !error && it != end;
+         it.increment(error)) {
+        const std::string name = it->path().filename().string();
+        if (name.size() > 16 && name.compare(0, 12, "iot-journal-") == 0 &&
+            name.compare(name.size() - 4, 4, ".bin") == 0 && it->is_regular_file(error)) {
+            existing.push_back(it->path().string());
+        }
+    }
+    if (error) {
+        spdlog::warn("[Journal] Cannot scan {}: {}", config_.directory, error.message());
+    }
+    std::sort(existing.begin(), existing.end());
+    files_.assign(existing.begin(), existing.end());
+    prune_files_locked();
+    if (!existing.empty()) {
+        spdlog::info("[Journal] Found {} existing file(s), keeping {}", existing.size(), files_.size());
+    }
+}
+
+void BinaryJournal::append_locked(uint16_t format, int64_t unix_ns, const void* payload, size_t size,
+                                  const void* extra, size_t extra_size) {
+    journal::RecordHeader header{};
+    header.format = format;
+    header.payload_size = static_cast<uint32_t>(journal::aligned(size + extra_size));
+    header.unix_ns = unix_ns;
+
+    char* out = base_ + offset_;
+    std::memcpy(out, &header, sizeof(header));
+    std::memcpy(out + sizeof(header), payload, size);
+    if (extra_size > 0) {
+        std::memcpy(out + sizeof(header) + size, extra, extra_size);
+    }
+    // Padding sudah bernilai nol (file baru hasil fallocate)
+    offset_ += sizeof(header) + header.payload_size;
+}
+
+size_t BinaryJournal::string_record_size(uint32_t id) {
+    if (id == utils::StringInterner::kEmpty) {
+        return 0;
+    }
+    size_t length = utils::StringInterner::global().resolve(id).size();
+    return sizeof(journal::RecordHeader) + journal::aligned(sizeof(journal::StringArgs) + length);
+}
+
+void BinaryJournal::define_string_locked(uint32_t id, int64_t unix_ns) {
+    if (id == utils::StringInterner::kEmpty || !defined_.insert(id).second) {
+        return;  // String kosong tidak perlu definisi; sudah ada di file ini
+    }
+    const std::string& text = utils::StringInterner::global().resolve(id);
+    journal::StringArgs args{id, static_cast<uint32_t>(text.size())};
+    append_locked(journal::STRING, unix_ns, &args, sizeof(args), text.data(), text.size());
+}
+
+void BinaryJournal::write_sensor(const SensorSample& sample, uint64_t skipped, bool anomaly) {
+    // Argumen disusun di luar lock (salinan field, tanpa format teks)
+    journal::SensorArgs args{};
+    args.skipped = skipped;
+    args.flags = anomaly ? journal::ANOMALY : 0;
+#define IOT_JOURNAL_SCALAR(type, name, tag) args.name = sample.name;
+#define IOT_JOURNAL_STRING(name, tag) args.name##_id = sample.name##_id;
+    IOT_SENSOR_REQUEST_FIELDS(IOT_JOURNAL_SCALAR, IOT_JOURNAL_STRING)
+#undef IOT_JOURNAL_SCALAR
+#undef IOT_JOURNAL_STRING
+    int64_t now = unix_now_ns();
+
+    // Ukuran terburuk: semua string belum didefinisikan di file ini
+    size_t needed = sizeof(journal::RecordHeader) + journal::aligned(sizeof(args));
+#define IOT_JOURNAL_STRING_SIZE(name, tag) needed += string_record_size(args.name##_id);
+#define IOT_JOURNAL_SKIP_SCALAR(type, name, tag)
+    IOT_SENSOR_REQUEST_FIELDS(IOT_JOURNAL_SKIP_SCALAR, IOT_JOURNAL_STRING_SIZE)
+#undef IOT_JOURNAL_STRING_SIZE
+#undef IOT_JOURNAL_SKIP_SCALAR
+
+    if (needed > config_.file_bytes - sizeof(journal::FileHeader)) {
+        // Tidak muat bahkan di file kosong: rotasi tidak membantu, hanya
+        // menutup file saat ini lebih awal (dan menghapus file lama)
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (base_ && offset_ + needed > config_.file_bytes) {
+        close_file_locked();
+        open_file_locked();
+        rotations_.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (!base_ || offset_ + needed > config_.file_bytes) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+#define IOT_JOURNAL_DEFINE(name, tag) define_string_locked(args.name##_id, now);
+#define IOT_JOURNAL_SKIP_SCALAR(type, name, tag)
+    IOT_SENSOR_REQUEST_FIELDS(IOT_JOURNAL_SKIP_SCALAR, IOT_JOURNAL_DEFINE)
+#undef IOT_JOURNAL_DEFINE
+#undef IOT_JOURNAL_SKIP_SCALAR
+    append_locked(journal::SENSOR_DATA, now, &args, sizeof(args));
+    written_.fetch_add(1, std::memory_order_relaxed);
+}
@@ -0,0 +1,110 @@
+#pragma once
+#include "pipeline/sensor_sample.h"
+#include "utils/log_util/journal_format.h"
+#include <absl/container/flat_hash_set.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+
+/**
+ * binary_journal.h -- Sink log biner untuk data sensor
+ *
+ * Record teks [DataLogger] berukuran ~600 byte per data dan diformat di
+ * thread data. BinaryJournal menulis record berukuran tetap (ID format +
+ * argumen mentah, lihat journal_format.h) langsung ke file yang di-mmap:
+ * biaya di thread data = isi struct + memcpy ke mapping (di bawah satu
+ * mutex). Teks baru dibentuk offline dengan tool iot_logdecode.
+ *
+ * File:
+ *   - <directory>/iot-journal-<start_ms>-<seq>.bin, dialokasikan penuh
+ *     (file_bytes) saat dibuka, sehingga menulis tidak pernah memperbesar file
+ *   - saat penuh: file ditutup (dipotong ke ukuran terpakai) dan file
+ *     berikutnya dibuka; hanya max_files file terakhir yang disimpan
+ *   - string intern (nama/lokasi sensor) didefinisikan SEKALI per file,
+ *     jadi setiap file bisa di-decode sendiri
+ *
+ * Durability: mapping MAP_SHARED -- data tetap ada di page cache walaupun
+ * proses crash (sisa file bernilai nol dibaca decoder sebagai akhir data),
+ * tetapi tidak di-fsync per record.
+ *
+ * Nilai dari environment variable (lihat create_log_handler() di app.cpp):
+ *   LOG_SINK, LOG_JOURNAL_DIR, LOG_JOURNAL_FILE_MB, LOG_JOURNAL_MAX_FILES
+ */
+struct BinaryJournalConfig {
+    std::string directory = "journal";        // Folder file journal
+    size_t file_bytes = 64 * 1024 * 1024;      // Ukuran satu file (dialokasikan di awal)
+    size_t max_files = 8;                      // File lama di atas jumlah ini dihapus
+};
+
+class BinaryJournal {
+public:
+    explicit BinaryJournal(const BinaryJournalConfig& config = {});
+    ~BinaryJournal();
+
+    BinaryJournal(const BinaryJournal&) = delete;
+    BinaryJournal& operator=(const BinaryJournal&) = delete;
+
+    /**
+     * Buat folder, daftarkan file journal yang sudah ada di folder (dari run
+     * sebelumnya) ke retensi max_files, lalu buka file pertama.
+     * @return false jika folder/file tidak bisa dibuat (journal nonaktif)
+     */
+    bool open();
+
+    /**
+     * Tulis satu record SENSOR_DATA (plus record STRING untuk string yang
+     * belum didefinisikan di file ini).
+     * @param skipped Data sensor ini yang dilewati sampling sejak record sebelumnya
+     * @param anomaly true = data anomali (journal::ANOMALY)
+     */
+    void write_sensor(const SensorSample& sample, uint64_t skipped, bool anomaly);
+
+    /// Jumlah record SENSOR_DATA yang ditulis
+    uint64_t written() const {
+        return written_.load(std::memory_order_relaxed);
+    }
+
+    /// Jumlah record yang gagal ditulis (journal tidak terbuka, atau record lebih besar dari satu file)
+    uint64_t dropped() const {
+        return dropped_.load(std::memory_order_relaxed);
+    }
+
+private:
+    bool open_file_locked();
+    void close_file_locked();
+
+    /// Hapus file terlama sampai jumlah file tertutup <= max_files
+    void prune_files_locked();
+
+    /// Isi files_ dengan file iot-journal-*.bin yang sudah ada di folder
+    void scan_existing_files_locked();
+
+    /// Tulis satu record (header + payload + extra) di offset_ saat ini
+    void append_locked(uint16_t format, int64_t unix_ns, const void* payload, size_t size,
+                       const void* extra = nullptr, size_t extra_size = 0);
+
+    /// Tulis record STRING jika id belum didefinisikan di file ini
+    void define_string_locked(uint32_t id, int64_t unix_ns);
+
+    /// Ukuran maksimal record STRING untuk id ini (untuk cek sisa ruang)
+    static size_t string_record_size(uint32_t id);
+
+    BinaryJournalConfig config_;
+    int64_t start_ms_ = 0;            // Bagian nama file (urutan antar restart)
+
+    std::mutex mutex_;
+    int fd_ = -1;
+    char* base_ = nullptr;            // Mapping file saat ini
+    size_t offset_ = 0;               // Posisi tulis berikutnya
+    uint64_t sequence_ = 0;           // Nomor file berikutnya
+    std::string path_;                // File saat ini
+    std::deque<std::string> files_;   // File yang sudah ditutup (terlama di depan)
+    absl::flat_hash_set<uint32_t> defined_;  // ID string yang sudah didefinisikan di file ini
+
+    std::atomic<uint64_t> written_{0};
+    std::atomic<uint64_t> dropped_{0};
+    std::atomic<uint64_t> rotations_{0};
+};
@@ -0,0 +1,89 @@
+#pragma once
+#include "sensor_fields.h"
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+/**
+ * journal_format.h -- Format file journal log biner (writer + decoder)
+ *
+ * Dipakai bersama oleh BinaryJournal (penulis, di iot_bridge) dan
+ * iot_logdecode (pembaca offline). Header ini sengaja hanya bergantung pada
+ * sensor_fields.h (tanpa protobuf/abseil) agar tool decoder tetap kecil.
+ *
+ * Layout file (little-endian, semua record rata 8 byte):
+ *
+ *   FileHeader                               (32 byte)
+ *   { RecordHeader + payload }*              (record berurutan)
+ *   RecordHeader dengan format = END         (sisa file yang masih nol)
+ *
+ * Setiap record = ID format + argumen mentah (tanpa teks). Teks baru dibentuk
+ * offline oleh iot_logdecode dari tabel format di bawah:
+ *
+ *   STRING      : definisi string intern (id -> teks), ditulis sekali per file
+ *                 sebelum record pertama yang memakainya
+ *   SENSOR_DATA : satu data sensor (SensorArgs), sama dengan record
+ *                 [DataLogger] versi teks
+ */
+namespace journal {
+    constexpr char kMagic[8] = {'I', 'O', 'T', 'J', 'R', 'N', 'L', '\0'};
+    constexpr uint32_t kVersion = 1;
+    constexpr size_t kAlignment = 8;
+
+    /// ID format record
+    enum Format : uint16_t {
+        END         = 0,  // Akhir data di file ini
+        STRING      = 1,  // Payload: StringArgs + teks (tanpa '\0')
+        SENSOR_DATA = 2   // Payload: SensorArgs
+    };
+
+    /// Flag record SENSOR_DATA
+    enum SensorFlags : uint32_t {
+        ANOMALY = 1u << 0  // Data melanggar aturan SensorDataValidator
+    };
+
+    struct FileHeader {
+        char magic[8];              // kMagic
+        uint32_t version;           // kVersion
+        uint32_t sensor_args_size;  // sizeof(SensorArgs) penulis (cek kecocokan schema)
+        int64_t created_unix_ns;    // Waktu file dibuat
+        uint64_t sequence;          // Nomor urut file (rotasi)
+    };
+
+    struct RecordHeader {
+        uint16_t format;        // Format
+        uint16_t reserved;
+        uint32_t payload_size;  // Ukuran payload (sudah dibulatkan ke kAlignment)
+        int64_t unix_ns;        // Waktu record ditulis
+    };
+
+    struct StringArgs {
+        uint32_t id;      // ID di StringInterner proses penulis
+        uint32_t length;  // Panjang teks setelah struct ini
+    };
+
+    /**
+     * Argumen record SENSOR_DATA. Field sensor di-generate dari
+     * IOT_SENSOR_REQUEST_FIELDS (urutan sensor.proto); field string disimpan
+     * sebagai ID intern (<name>_id), teksnya ada di record STRING.
+     */
+    struct SensorArgs {
+        uint64_t skipped;  // Data yang dilewati sampling sejak record sebelumnya
+        uint32_t flags;    // SensorFlags
+        uint32_t reserved;
+#define IOT_JOURNAL_SCALAR(type, name, tag) type name;
+#define IOT_JOURNAL_STRING(name, tag) uint32_t name##_id;
+        IOT_SENSOR_REQUEST_FIELDS(IOT_JOURNAL_SCALAR, IOT_JOURNAL_STRING)
+#undef IOT_JOURNAL_SCALAR
+#undef IOT_JOURNAL_STRING
+    };
+
+    static_assert(sizeof(FileHeader) == 32, "FileHeader harus 32 byte");
+    static_assert(sizeof(RecordHeader) == 16, "RecordHeader harus 16 byte");
+    static_assert(std::is_trivially_copyable<SensorArgs>::value, "SensorArgs ditulis apa adanya");
+
+    /// Bulatkan ukuran payload ke kAlignment
+    constexpr size_t aligned(size_t size) {
+        return (size + kAlignment - 1) & ~(kAlignment - 1);
+    }
+}
@@ -1,7 +1,9 @@
 #pragma once
 #include <spdlog/spdlog.h>
+#include <spdlog/async.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
 #include <cstdlib>
+#include <memory>
 #include <string>
 
 /**
@@ -23,6 +25,16 @@
  * 
  * Format log: [tanggal waktu] [LEVEL] pesan
  * Contoh:     [2026-02-19 10:30:45.123] [info] DDS: Initialized successfully
+ * 
+ * Mode async (LOG_ASYNC, default "on"):
+ *   Thread pemanggil hanya memformat pesan lalu memasukkannya ke antrian
+ *   ring berkapasitas tetap (LOG_QUEUE_SIZE record); SATU thread background
+ *   yang menulis ke sink stdout berwarna. Jika antrian penuh (LOG_OVERFLOW):
+ *   - "drop_oldest" : record tertua ditimpa (default, thread data tidak pernah menunggu)
+ *   - "block"       : pemanggil menunggu sampai ada slot (tidak ada log hilang)
+ *   Jumlah record yang ditimpa tersedia lewat log_dropped_count(); app.cpp
+ *   melaporkannya sebagai warn setiap kali bertambah (STATS_INTERVAL_SEC)
+ *   dan sekali lagi saat shutdown_logger().
  */
 namespace utils {
     /**
@@ -57,13 +69,33 @@ namespace utils {
      * Inisialisasi logger spdlog.
      * 
      * Konfigurasi:
-     *   1. Set format output: [tanggal waktu.milidetik] [LEVEL] pesan
-     *   2. Baca log level dari environment variable LOG_LEVEL
-     *   3. Terapkan log level (default: info)
+     *   1. Mode async (LOG_ASYNC, LOG_QUEUE_SIZE, LOG_OVERFLOW): ganti logger
+     *      default dengan async_logger di atas thread pool spdlog
+     *   2. Set format output: [tanggal waktu.milidetik] [LEVEL] pesan
+     *   3. Baca log level dari environment variable LOG_LEVEL
+     *   4. Terapkan log level (default: info)
      * 
      * Harus dipanggil SEKALI di awal main() sebelum komponen lain diinisialisasi.
      */
     inline void init_logger() {
+        const char* async_env = std::getenv("LOG_ASYNC");
+        bool async = !(async_env && std::string(async_env) == "off");
+        const char* queue_env = std::getenv("LOG_QUEUE_SIZE");
+        long queue_env_size = (queue_env && *queue_env) ? std::atol(queue_env) : 0;
+        size_t queue_size = queue_env_size > 0 ? static_cast<size_t>(queue_env_size) : 8192;
+        const char* overflow_env = std::getenv("LOG_OVERFLOW");
+        bool block = overflow_env && std::string(overflow_env) == "block";
+
+        if (async) {
+            // Antrian ring + 1 thread penulis; logger default diganti async_logger
+            spdlog::init_thread_pool(queue_size, 1);
+            auto sink = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
+            auto logger = std::make_shared<spdlog::async_logger>(
+                "iot", std::move(sink), spdlog::thread_pool(),
+                block ? spdlog::async_overflow_policy::block : spdlog::async_overflow_policy::overrun_oldest);
+            spdlog::set_default_logger(std::move(logger));
+        }
+
         // Set format: [tahun-bulan-tanggal jam:menit:detik.milidetik] [LEVEL] pesan
         // %^ dan %$ menandai bagian yang diberi warna (hanya level)
         spdlog::set_pattern("[%Y-%m-%d %H:%M:%S.%e] [%^%l%$] %v");
@@ -73,6 +105,32 @@ namespace utils {
         std::string level = level_env ? std::string(level_env) : "info";
         spdlog::set_level(parse_log_level(level));  // Terapkan level
 
-        spdlog::info("Logger module initialized (level: {})", level);
+        if (async) {
+            spdlog::info("Logger module initialized (level: {}, async queue={}, overflow={})",
+                         level, queue_size, block ? "block" : "drop_oldest");
+        } else {
+            spdlog::info("Logger module initialized (level: {})", level);
+        }
+    }
+
+    /**
+     * Jumlah record log yang dibuang karena antrian async penuh
+     * (policy drop_oldest). Selalu 0 pada mode sync atau policy block.
+     */
+    inline size_t log_dropped_count() {
+        auto pool = spdlog::thread_pool();
+        return pool ? pool->overrun_counter() : 0;
+    }
+
+    /**
+     * Tutup logger: tunggu antrian async dikosongkan, lalu hentikan thread
+     * penulis. Dipanggil sekali sebelum main() return.
+     */
+    inline void shutdown_logger() {
+        size_t dropped = log_dropped_count();
+        if (dropped > 0) {
+            spdlog::warn("Logger: {} record(s) dropped (async queue full)", dropped);
+        }
+        spdlog::shutdown();
     }
 }
@@ -0,0 +1,182 @@
+#pragma once
+#include "pipeline/sensor_sample.h"
+#include "sensor.pb.h"
+#include <absl/container/flat_hash_map.h>
+#include <absl/types/span.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * sensor_batch.h -- Utility untuk decode/encode SensorBatch (format kolom)
+ *
+ * SensorBatch (lihat proto/sensor.proto) menyimpan banyak data sensor
+ * kolom per kolom: sensor_id[], timestamp_delta[], temperature[], dst.
+ * Pipeline internal (observer + bridge) bekerja dengan SensorSample,
+ * jadi batch perlu di-"transpose" kembali menjadi baris-baris SensorSample.
+ *
+ * Fungsi ini dipanggil oleh SensorController::SendSensorBatch() dan
+ * AsyncSensorController sebelum batch diteruskan sebagai SATU unit ke
+ * notify_observers_batch() dan broadcast_sensor_batch().
+ *
+ * Arah sebaliknya (encode_sensor_batch) dipakai WebSocket untuk client
+ * subprotocol protobuf saat micro-batch aktif (lihat payload_format.h).
+ */
+namespace utils {
+    /**
+     * Decode SensorBatch menjadi daftar SensorSample.
+     *
+     * Proses:
+     *   1. Validasi: setiap kolom harus kosong ATAU sepanjang kolom sensor_id
+     *   2. Akumulasi timestamp_delta menjadi timestamp absolut (batch
+     *      ditolak jika jumlahnya overflow int64)
+     *   3. Intern setiap entri kamus `strings` SEKALI per batch, lalu
+     *      sensor_name_ref/location_ref cukup dipetakan ke ID intern
+     *
+     * Vector output di-resize (bukan di-clear lalu push_back) agar
+     * kapasitasnya bisa dipakai ulang jika vector yang sama digunakan
+     * berkali-kali.
+     *
+     * @param batch Batch dari client (format kolom)
+     * @param out   Vector tujuan, berisi batch.sensor_id_size() data setelah sukses
+     * @param error Diisi pesan error jika batch tidak valid
+     * @return OK; INVALID jika batch tidak valid (termasuk string terlalu
+     *         panjang); EXHAUSTED jika tabel intern penuh
+     */
+    inline ConvertStatus decode_sensor_batch(const iot::SensorBatch& batch,
+                                    std::vector<SensorSample>& out,
+                                    std::string& error) {
+        const int count = batch.sensor_id_size();
+
+        // Kolom opsional: kosong (semua default) atau panjangnya sama dengan sensor_id
+        auto column_ok = [count](int size) { return size == 0 || size == count; };
+        if (!column_ok(batch.timestamp_delta_size()) ||
+            !column_ok(batch.temperature_size()) ||
+            !column_ok(batch.humidity_size()) ||
+            !column_ok(batch.pressure_size()) ||
+            !column_ok(batch.light_intensity_size()) ||
+            !column_ok(batch.sensor_name_ref_size()) ||
+            !column_ok(batch.location_ref_size())) {
+            error = "SensorBatch: column length mismatch (expected " + std::to_string(count) + ")";
+            return ConvertStatus::INVALID;
+        }
+
+        const auto string_count = static_cast<uint32_t>(batch.strings_size());
+        const bool has_ts    = batch.timestamp_delta_size() > 0;
+        const bool has_temp  = batch.temperature_size() > 0;
+        const bool has_hum   = batch.humidity_size() > 0;
+        const bool has_press = batch.pressure_size() > 0;
+        const bool has_light = batch.light_intensity_size() > 0;
+        const bool has_name  = batch.sensor_name_ref_size() > 0;
+        const bool has_loc   = batch.location_ref_size() > 0;
+
+        // Kamus string batch -> ID intern (lookup intern hanya sekali per string unik)
+        std::vector<StringInterner::Id> string_ids;
+        if (has_name || has_loc) {
+            string_ids.resize(string_count);
+            for (uint32_t i = 0; i < string_count; ++i) {
+                ConvertStatus status = intern_field("SensorBatch: strings entry",
+                                                    batch.strings(static_cast<int>(i)),
+                                                    string_ids[i], error);
+                if (status != ConvertStatus::OK) {
+                    return status;
+                }
+            }
+        }
+
+        out.resize(static_cast<size_t>(count));
+        int64_t timestamp = 0;  // Akumulator delta -> timestamp absolut
+
+        for (int i = 0; i < count; ++i) {
+            SensorSample& reading = out[static_cast<size_t>(i)];
+            reading.sensor_id = batch.sensor_id(i);
+
+            if (has_ts && __builtin_add_overflow(timestamp, batch.timestamp_delta(i), &timestamp)) {
+                error = "SensorBatch: timestamp_delta overflow at index " + std::to_string(i);
+                return ConvertStatus::INVALID;
+            }
+            reading.timestamp = timestamp;
+
+            reading.temperature = has_temp ? batch.temperature(i) : 0.0;
+            reading.humidity = has_hum ? batch.humidity(i) : 0.0;
+            reading.pressure = has_press ? batch.pressure(i) : 0.0;
+            reading.light_intensity = has_light ? batch.light_intensity(i) : 0.0;
+
+            if (has_name) {
+                uint32_t ref = batch.sensor_name_ref(i);
+                if (ref >= string_count) {
+                    error = "SensorBatch: sensor_name_ref out of range at index " + std::to_string(i);
+                    return ConvertStatus::INVALID;
+                }
+                reading.sensor_name_id = string_ids[ref];
+            } else {
+                reading.sensor_name_id = StringInterner::kEmpty;
+            }
+
+            if (has_loc) {
+                uint32_t ref = batch.location_ref(i);
+                if (ref >= string_count) {
+                    error = "SensorBatch: location_ref out of range at index " + std::to_string(i);
+                    return ConvertStatus::INVALID;
+                }
+                reading.location_id = string_ids[ref];
+            } else {
+                reading.location_id = StringInterner::kEmpty;
+            }
+        }
+        return ConvertStatus::OK;
+    }
+
+    /**
+     * Encode data sensor menjadi SensorBatch (kebalikan decode_sensor_batch).
+     *
+     * Nama sensor dan lokasi dimasukkan ke kamus `strings` SEKALI per
+     * nilai unik (kunci: ID StringInterner), timestamp di-delta-encode
+     * terhadap data sebelumnya. Delta dihitung modulo 2^64 (timestamp dari
+     * client bebas, selisihnya bisa melebihi int64): penjumlahan kembali
+     * secara wrapping (two's complement) selalu menghasilkan timestamp asli.
+     *
+     * @param samples Sumber data
+     * @param indices Posisi data yang di-encode (urut); semua data jika kosong
+     * @param batch   [out] Dikosongkan lalu diisi
+     */
+    inline void encode_sensor_batch(absl::Span<const SensorSample> samples,
+                                    absl::Span<const uint32_t> indices,
+                                    iot::SensorBatch* batch) {
+        batch->Clear();
+        const size_t count = indices.empty() ? samples.size() : indices.size();
+        batch->mutable_sensor_id()->Reserve(static_cast<int>(count));
+        batch->mutable_timestamp_delta()->Reserve(static_cast<int>(count));
+        batch->mutable_temperature()->Reserve(static_cast<int>(count));
+        batch->mutable_humidity()->Reserve(static_cast<int>(count));
+        batch->mutable_pressure()->Reserve(static_cast<int>(count));
+        batch->mutable_light_intensity()->Reserve(static_cast<int>(count));
+        batch->mutable_sensor_name_ref()->Reserve(static_cast<int>(count));
+        batch->mutable_location_ref()->Reserve(static_cast<int>(count));
+
+        absl::flat_hash_map<uint32_t, uint32_t> refs;  // ID intern -> index di `strings`
+        auto ref_for = [&](uint32_t string_id, const std::string& value) {
+            auto inserted = refs.try_emplace(string_id, static_cast<uint32_t>(batch->strings_size()));
+            if (inserted.second) {
+                batch->add_strings(value);
+            }
+            return inserted.first->second;
+        };
+
+        int64_t previous_ts = 0;
+        for (size_t i = 0; i < count; ++i) {
+            const SensorSample& sample = samples[indices.empty() ? i : indices[i]];
+            batch->add_sensor_id(sample.sensor_id);
+            // Aritmetika unsigned: tidak ada signed overflow (UB)
+            batch->add_timestamp_delta(static_cast<int64_t>(
+                static_cast<uint64_t>(sample.timestamp) - static_cast<uint64_t>(previous_ts)));
+            previous_ts = sample.timestamp;
+            batch->add_temperature(sample.temperature);
+            batch->add_humidity(sample.humidity);
+            batch->add_pressure(sample.pressure);
+            batch->add_light_intensity(sample.light_intensity);
+            batch->add_sensor_name_ref(ref_for(sample.sensor_name_id, sample.sensor_name()));
+            batch->add_location_ref(ref_for(sample.location_id, sample.location()));
+        }
+    }
+}
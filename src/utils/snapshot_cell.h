@@ -0,0 +1,122 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+/**
+ * snapshot_cell.h -- Wadah snapshot copy-on-write dengan reader tanpa lock
+ *
+ * std::atomic_load/atomic_store pada shared_ptr TIDAK lock-free di
+ * libstdc++: keduanya mengambil mutex dari pool yang dipilih berdasarkan
+ * alamat shared_ptr. Semua reader satu snapshot memakai alamat yang sama,
+ * jadi semuanya antre di mutex yang sama -- sama saja dengan satu mutex.
+ *
+ * SnapshotCell memisahkan jalur baca dari jalur tulis:
+ *   - Writer (jarang) mengganti snapshot di bawah mutex lalu menaikkan
+ *     version_ (atomic).
+ *   - Setiap thread menyimpan salinan shared_ptr snapshot terakhir yang
+ *     dibacanya (thread_local, per cell) beserta version-nya. read() hanya
+ *     membaca version_ (load acquire) lalu mengembalikan salinan lokal itu:
+ *     tanpa mutex, tanpa menulis ke cache line bersama (refcount tidak
+ *     disentuh). Mutex hanya diambil sekali per thread setelah ada writer.
+ *   - Snapshot lama dibebaskan saat thread terakhir yang menyimpannya
+ *     membaca versi baru (refcount shared_ptr).
+ *
+ * Batasan:
+ *   - Referensi dari read() valid sampai thread yang sama memanggil read()
+ *     pada cell yang SAMA lagi (cache bisa diganti ke versi baru). Salin
+ *     shared_ptr-nya jika snapshot perlu disimpan lebih lama (misalnya
+ *     di-capture ke task thread lain).
+ *   - Thread yang berhenti membaca tetap memegang snapshot terakhirnya
+ *     sampai thread itu selesai (maksimal satu snapshot per thread per cell),
+ *     termasuk snapshot cell yang sudah dihapus. Cell ditujukan untuk objek
+ *     berumur panjang (Observable, index koneksi), bukan objek per request.
+ */
+namespace utils {
+    namespace detail {
+        /// ID unik setiap SnapshotCell (alamat bisa dipakai ulang setelah cell dihapus)
+        inline uint64_t next_snapshot_cell_id() {
+            static std::atomic<uint64_t> next{1};
+            return next.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    template <typename T>
+    class SnapshotCell {
+    public:
+        using Ptr = std::shared_ptr<const T>;
+
+        explicit SnapshotCell(Ptr initial = std::make_shared<const T>()) : current_(std::move(initial)) {}
+
+        SnapshotCell(const SnapshotCell&) = delete;
+        SnapshotCell& operator=(const SnapshotCell&) = delete;
+
+        /**
+         * Snapshot saat ini untuk thread pemanggil (tanpa lock jika tidak
+         * ada writer sejak pembacaan terakhir thread ini).
+         * @return Referensi ke shared_ptr di cache thread ini (lihat batasan di atas)
+         */
+        const Ptr& read() const {
+            Entry& entry = local_entry();
+            if (entry.version != version_.load(std::memory_order_acquire)) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                entry.snapshot = current_;
+                entry.version = version_.load(std::memory_order_relaxed);
+            }
+            return entry.snapshot;
+        }
+
+        /**
+         * Salinan snapshot saat ini (mengambil mutex). Untuk writer yang
+         * menyalin snapshot sebelum mengubahnya.
+         */
+        Ptr load() const {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return current_;
+        }
+
+        /**
+         * Publish snapshot baru. Reader melihatnya pada read() berikutnya.
+         * Writer yang melakukan read-modify-write harus saling mengecualikan sendiri.
+         */
+        void store(Ptr next) {
+            Ptr previous;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                previous = std::exchange(current_, std::move(next));
+                version_.fetch_add(1, std::memory_order_release);
+            }
+            // previous dibebaskan di luar lock (jika tidak ada thread lain yang menyimpannya)
+        }
+
+    private:
+        struct Entry {
+            uint64_t cell_id;
+            uint64_t version;
+            Ptr snapshot;
+        };
+
+        /**
+         * Cache thread ini untuk cell ini. deque: alamat entry stabil saat
+         * thread mulai membaca cell lain (referensi dari read() tidak rusak).
+         */
+        Entry& local_entry() const {
+            thread_local std::deque<Entry> cache;
+            for (Entry& entry : cache) {
+                if (entry.cell_id == id_) {
+                    return entry;
+                }
+            }
+            cache.push_back(Entry{id_, 0, nullptr});  // version 0: selalu diisi pada read() pertama
+            return cache.back();
+        }
+
+        const uint64_t id_ = detail::next_snapshot_cell_id();
+        std::atomic<uint64_t> version_{1};
+        mutable std::mutex mutex_;  // Melindungi current_ (writer + refresh cache)
+        Ptr current_;
+    };
+}
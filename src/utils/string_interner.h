@@ -0,0 +1,206 @@
+#pragma once
+#include <absl/container/flat_hash_map.h>
+#include <absl/strings/string_view.h>
+#include <spdlog/spdlog.h>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+
+/**
+ * string_interner.h -- Tabel string global (intern table) untuk SensorSample
+ *
+ * sensor_name dan location hampir selalu SAMA untuk setiap data dari satu
+ * sensor ("Sensor-1", "Room A"). Daripada menyalin std::string di setiap
+ * data, string disimpan SEKALI di tabel ini dan data cukup membawa ID 32-bit.
+ *
+ *   intern("Room A")  -> 3      (lookup: shared lock; string baru: unique lock)
+ *   resolve(3)        -> "Room A" (TANPA lock)
+ *
+ * Penyimpanan:
+ *   - String disimpan dalam chunk berukuran tetap yang tidak pernah dipindah
+ *     atau dibebaskan, sehingga referensi dari resolve() selalu valid.
+ *   - ID 0 selalu string kosong (nilai default SensorSample).
+ *   - Kapasitas dibatasi (kMaxStrings string, masing-masing maksimal
+ *     kMaxLength byte), agar client yang mengirim string acak/panjang tidak
+ *     bisa menghabiskan memori. String yang tidak bisa disimpan TIDAK
+ *     diam-diam menjadi "": try_intern() melaporkan sebabnya, dan
+ *     controller menolak request tersebut (lihat utils::to_sample()).
+ */
+namespace utils {
+
+class StringInterner {
+public:
+    using Id = uint32_t;
+
+    static constexpr Id kEmpty = 0;              // ID untuk string kosong
+    static constexpr size_t kChunkSize = 1024;   // String per chunk
+    static constexpr size_t kMaxChunks = 256;    // Maksimal 262.144 string unik
+    static constexpr size_t kMaxStrings = kChunkSize * kMaxChunks;
+    static constexpr size_t kMaxLength = 256;    // Panjang maksimal satu string (byte)
+
+    /// Hasil try_intern()
+    enum class Result {
+        OK,
+        TOO_LONG,  // String lebih panjang dari kMaxLength
+        FULL       // Tabel penuh dan string belum terdaftar
+    };
+
+    StringInterner() {
+        store("");  // ID 0 = string kosong
+    }
+
+    StringInterner(const StringInterner&) = delete;
+    StringInterner& operator=(const StringInterner&) = delete;
+
+    ~StringInterner() {
+        for (auto& chunk : chunks_) {
+            delete[] chunk.load(std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * Instance global yang dipakai controller, observer, dan adapter.
+     */
+    static StringInterner& global() {
+        static StringInterner instance;
+        return instance;
+    }
+
+    /**
+     * Dapatkan ID untuk string (daftarkan jika belum ada).
+     * Jalur cepat (string sudah terdaftar) hanya mengambil shared lock.
+     * @param id [out] ID string (kEmpty untuk string kosong atau jika gagal)
+     * @return OK, TOO_LONG, atau FULL (string baru saat tabel penuh)
+     */
+    Result try_intern(absl::string_view value, Id& id) {
+        id = kEmpty;
+        if (value.empty()) {
+            return Result::OK;
+        }
+        if (value.size() > kMaxLength) {
+            rejected_.fetch_add(1, std::memory_order_relaxed);
+            return Result::TOO_LONG;
+        }
+        {
+            std::shared_lock<std::shared_mutex> lock(mutex_);
+            auto it = ids_.find(value);
+            if (it != ids_.end()) {
+                id = it->second;
+                return Result::OK;
+            }
+        }
+
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        auto it = ids_.find(value);  // Cek ulang: thread lain mungkin lebih dulu
+        if (it != ids_.end()) {
+            id = it->second;
+            return Result::OK;
+        }
+        if (size_.load(std::memory_order_relaxed) >= kMaxStrings) {
+            rejected_.fetch_add(1, std::memory_order_relaxed);
+            if (!full_logged_) {
+                spdlog::error("StringInterner: Table full ({} strings), requests with new "
+                              "sensor names/locations are rejected", kMaxStrings);
+                full_logged_ = true;
+            }
+            return Result::FULL;
+        }
+        id = store(value);
+        return Result::OK;
+    }
+
+    /**
+     * try_intern() untuk string tepercaya (bukan dari client).
+     * @return ID string, atau kEmpty jika string kosong / tidak bisa disimpan
+     */
+    Id intern(absl::string_view value) {
+        Id id;
+        try_intern(value, id);
+        return id;
+    }
+
+    /**
+     * Cari ID string yang SUDAH terdaftar tanpa mendaftarkan string baru.
+     * Dipakai untuk input yang tidak dipercaya (misalnya filter langganan
+     * client WebSocket) agar tidak bisa memenuhi tabel global.
+     * @param id [out] ID string (kEmpty untuk string kosong)
+     * @return false jika string belum pernah di-intern
+     */
+    bool find(absl::string_view value, Id& id) const {
+        if (value.empty()) {
+            id = kEmpty;
+            return true;
+        }
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        auto it = ids_.find(value);
+        if (it == ids_.end()) {
+            return false;
+        }
+        id = it->second;
+        return true;
+    }
+
+    /**
+     * Ambil string untuk ID. Tanpa lock: ID hanya didapat dari intern(),
+     * yang sudah mem-publish isi slot (release) sebelum ID-nya dikembalikan.
+     * @return Referensi stabil ke string (string kosong jika ID tidak dikenal)
+     */
+    const std::string& resolve(Id id) const {
+        if (id >= size_.load(std::memory_order_acquire)) {
+            return empty_;
+        }
+        const std::string* chunk = chunks_[id / kChunkSize].load(std::memory_order_acquire);
+        return chunk[id % kChunkSize];
+    }
+
+    /// Jumlah string unik yang terdaftar (termasuk string kosong)
+    size_t size() const {
+        return size_.load(std::memory_order_acquire);
+    }
+
+    /// true jika tidak ada slot untuk string baru
+    bool full() const {
+        return size() >= kMaxStrings;
+    }
+
+    /// Jumlah string yang ditolak (TOO_LONG + FULL) sejak start
+    uint64_t rejected() const {
+        return rejected_.load(std::memory_order_relaxed);
+    }
+
+private:
+    /**
+     * Simpan string baru dan kembalikan ID-nya. Dipanggil di bawah unique lock
+     * (atau dari constructor).
+     */
+    Id store(absl::string_view value) {
+        size_t id = size_.load(std::memory_order_relaxed);
+        size_t chunk_index = id / kChunkSize;
+
+        std::string* chunk = chunks_[chunk_index].load(std::memory_order_relaxed);
+        if (!chunk) {
+            chunk = new std::string[kChunkSize];
+            chunks_[chunk_index].store(chunk, std::memory_order_release);
+        }
+
+        std::string& slot = chunk[id % kChunkSize];
+        slot.assign(value.data(), value.size());
+        ids_.emplace(absl::string_view(slot), static_cast<Id>(id));  // Key menunjuk ke slot (stabil)
+        size_.store(id + 1, std::memory_order_release);
+        return static_cast<Id>(id);
+    }
+
+    mutable std::shared_mutex mutex_;                       // Melindungi ids_ dan penulisan slot
+    absl::flat_hash_map<absl::string_view, Id> ids_;        // string -> ID
+    std::array<std::atomic<std::string*>, kMaxChunks> chunks_{};  // Penyimpanan string (stabil)
+    std::atomic<size_t> size_{0};
+    bool full_logged_ = false;                              // Dilindungi mutex_ (unique)
+    std::atomic<uint64_t> rejected_{0};
+    const std::string empty_;
+};
+
+}  // namespace utils
@@ -0,0 +1,204 @@
+/**
+ * client_session.cpp -- Parse dan evaluasi filter langganan client WebSocket
+ */
+#include "client_session.h"
+#include <rapidjson/document.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+#include <algorithm>
+
+namespace {
+// Batas jumlah kriteria per client agar satu client tidak membengkakkan index
+constexpr rapidjson::SizeType kMaxFilterEntries = 1024;
+
+/**
+ * Ambil nilai field numerik dari SensorSample.
+ */
+double field_value(const SensorSample& sample, SensorField field) {
+    switch (field) {
+    case SensorField::TEMPERATURE:     return sample.temperature;
+    case SensorField::HUMIDITY:        return sample.humidity;
+    case SensorField::PRESSURE:        return sample.pressure;
+    case SensorField::LIGHT_INTENSITY: return sample.light_intensity;
+    }
+    return 0.0;
+}
+
+/**
+ * Nama field JSON -> SensorField.
+ * @return false jika nama field tidak dikenal
+ */
+bool parse_field(const std::string& name, SensorField& field) {
+    if (name == "temperature")     { field = SensorField::TEMPERATURE;     return true; }
+    if (name == "humidity")        { field = SensorField::HUMIDITY;        return true; }
+    if (name == "pressure")        { field = SensorField::PRESSURE;        return true; }
+    if (name == "light_intensity") { field = SensorField::LIGHT_INTENSITY; return true; }
+    return false;
+}
+}  // namespace
+
+bool ValuePredicate::matches(const SensorSample& sample) const {
+    double value = field_value(sample, field);
+    return value >= min && value <= max;
+}
+
+bool SubscriptionFilter::matches(const SensorSample& sample) const {
+    if (!active) {
+        return false;
+    }
+    if (!sensor_ids.empty() &&
+        std::find(sensor_ids.begin(), sensor_ids.end(), sample.sensor_id) == sensor_ids.end()) {
+        return false;
+    }
+    if (has_locations() &&
+        std::find(location_ids.begin(), location_ids.end(), sample.location_id) == location_ids.end() &&
+        (location_names.empty() ||
+         std::find(location_names.begin(), location_names.end(), sample.location()) == location_names.end())) {
+        return false;
+    }
+    for (const auto& predicate : predicates) {
+        if (!predicate.matches(sample)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+namespace utils {
+
+bool parse_subscription(const std::string& message, SubscriptionFilter& filter, std::string& error) {
+    rapidjson::Document doc;
+    doc.Parse(message.c_str(), message.size());
+    if (doc.HasParseError() || !doc.IsObject()) {
+        error = "message must be a JSON object";
+        return false;
+    }
+
+    auto action = doc.FindMember("action");
+    if (action == doc.MemberEnd() || !action->value.IsString()) {
+        error = "missing \"action\"";
+        return false;
+    }
+
+    std::string action_name = action->value.GetString();
+    if (action_name == "unsubscribe") {
+        filter = SubscriptionFilter{};
+        filter.active = false;
+        return true;
+    }
+    if (action_name != "subscribe") {
+        error = "unknown action \"" + action_name + "\"";
+        return false;
+    }
+
+    SubscriptionFilter parsed;
+
+    auto ids = doc.FindMember("sensor_ids");
+    if (ids != doc.MemberEnd()) {
+        if (!ids->value.IsArray() || ids->value.Size() > kMaxFilterEntries) {
+            error = "\"sensor_ids\" must be an array of at most 1024 integers";
+            return false;
+        }
+        for (const auto& id : ids->value.GetArray()) {
+            if (!id.IsInt()) {
+                error = "\"sensor_ids\" must contain integers";
+                return false;
+            }
+            parsed.sensor_ids.push_back(id.GetInt());
+        }
+    }
+
+    auto locations = doc.FindMember("locations");
+    if (locations != doc.MemberEnd()) {
+        if (!locations->value.IsArray() || locations->value.Size() > kMaxFilterEntries) {
+            error = "\"locations\" must be an array of at most 1024 strings";
+            return false;
+        }
+        const StringInterner& interner = StringInterner::global();
+        for (const auto& location : locations->value.GetArray()) {
+            if (!location.IsString()) {
+                error = "\"locations\" must contain strings";
+                return false;
+            }
+            absl::string_view name(location.GetString(), location.GetStringLength());
+            StringInterner::Id id = StringInterner::kEmpty;
+            if (interner.find(name, id)) {
+                parsed.location_ids.push_back(id);
+            } else {
+                parsed.location_names.emplace_back(name);  // Belum dikenal: JANGAN di-intern
+            }
+        }
+    }
+
+    auto where = doc.FindMember("where");
+    if (where != doc.MemberEnd()) {
+        if (!where->value.IsObject()) {
+            error = "\"where\" must be an object";
+            return false;
+        }
+        for (const auto& member : where->value.GetObject()) {
+            ValuePredicate predicate;
+            if (!parse_field(member.name.GetString(), predicate.field)) {
+                error = std::string("unknown field \"") + member.name.GetString() + "\"";
+                return false;
+            }
+            if (!member.value.IsObject()) {
+                error = "predicate must be an object with \"min\" and/or \"max\"";
+                return false;
+            }
+            auto min = member.value.FindMember("min");
+            if (min != member.value.MemberEnd() && min->value.IsNumber()) {
+                predicate.min = min->value.GetDouble();
+            }
+            auto max = member.value.FindMember("max");
+            if (max != member.value.MemberEnd() && max->value.IsNumber()) {
+                predicate.max = max->value.GetDouble();
+            }
+            parsed.predicates.push_back(predicate);
+        }
+    }
+
+    // Urutkan + buang duplikat agar entri index per client unik
+    std::sort(parsed.sensor_ids.begin(), parsed.sensor_ids.end());
+    parsed.sensor_ids.erase(std::unique(parsed.sensor_ids.begin(), parsed.sensor_ids.end()),
+                            parsed.sensor_ids.end());
+    std::sort(parsed.location_ids.begin(), parsed.location_ids.end());
+    parsed.location_ids.erase(std::unique(parsed.location_ids.begin(), parsed.location_ids.end()),
+                              parsed.location_ids.end());
+    std::sort(parsed.location_names.begin(), parsed.location_names.end());
+    parsed.location_names.erase(std::unique(parsed.location_names.begin(), parsed.location_names.end()),
+                                parsed.location_names.end());
+
+    filter = std::move(parsed);
+    return true;
+}
+
+std::string subscription_ack_json(const SubscriptionFilter& filter) {
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    writer.StartObject();
+    writer.Key("type");
+    writer.String(filter.active ? "subscribed" : "unsubscribed");
+    writer.Key("sensor_ids");
+    writer.Uint(static_cast<unsigned>(filter.sensor_ids.size()));
+    writer.Key("locations");
+    writer.Uint(static_cast<unsigned>(filter.location_ids.size() + filter.location_names.size()));
+    writer.Key("predicates");
+    writer.Uint(static_cast<unsigned>(filter.predicates.size()));
+    writer.EndObject();
+    return buffer.GetString();
+}
+
+std::string subscription_error_json(const std::string& error) {
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    writer.StartObject();
+    writer.Key("type");
+    writer.String("error");
+    writer.Key("message");
+    writer.String(error.c_str(), static_cast<rapidjson::SizeType>(error.size()));
+    writer.EndObject();
+    return buffer.GetString();
+}
+
+}  // namespace utils
@@ -0,0 +1,119 @@
+#pragma once
+#include "pipeline/sensor_sample.h"
+#include "websocket/payload_format.h"
+#include "websocket/slow_consumer.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * client_session.h -- Filter langganan (subscription) per client WebSocket
+ *
+ * Secara default setiap client menerima SEMUA data sensor. Client bisa
+ * mengirim pesan subscribe untuk membatasi data yang diterimanya:
+ *
+ *   {"action": "subscribe",
+ *    "sensor_ids": [1, 2],                 // opsional, kosong = semua sensor
+ *    "locations": ["Room A"],              // opsional, kosong = semua lokasi
+ *    "where": {                            // opsional, predikat nilai (AND)
+ *        "temperature": {"min": 20, "max": 30},
+ *        "humidity":    {"max": 80}
+ *    }}
+ *
+ *   {"action": "unsubscribe"}              // berhenti menerima data
+ *
+ * Semua kriteria digabung dengan AND; di dalam sensor_ids / locations
+ * berlaku OR. Pesan subscribe baru MENGGANTI filter lama.
+ */
+
+/**
+ * Field numerik SensorSample yang bisa dipakai di predikat "where".
+ */
+enum class SensorField {
+    TEMPERATURE,
+    HUMIDITY,
+    PRESSURE,
+    LIGHT_INTENSITY
+};
+
+/**
+ * Predikat rentang nilai: min <= field <= max (batas yang tidak diisi = tak hingga).
+ */
+struct ValuePredicate {
+    SensorField field = SensorField::TEMPERATURE;
+    double min = -1e308;
+    double max = 1e308;
+
+    bool matches(const SensorSample& sample) const;
+};
+
+/**
+ * Filter langganan satu client.
+ */
+struct SubscriptionFilter {
+    bool active = true;                     // false = unsubscribe (tidak menerima apa pun)
+    std::vector<int32_t> sensor_ids;        // Kosong = semua sensor
+    std::vector<uint32_t> location_ids;     // Lokasi yang sudah dikenal (ID StringInterner)
+    std::vector<std::string> location_names; // Lokasi yang belum dikenal (dicocokkan per string)
+    std::vector<ValuePredicate> predicates; // Semua harus terpenuhi
+
+    /// true jika filter menyebut lokasi (location_ids dan location_names kosong = semua lokasi)
+    bool has_locations() const {
+        return !location_ids.empty() || !location_names.empty();
+    }
+
+    /// true jika filter menerima semua data (tanpa kriteria apa pun)
+    bool is_wildcard() const {
+        return active && sensor_ids.empty() && !has_locations() && predicates.empty();
+    }
+
+    /**
+     * Cek lengkap apakah data cocok dengan filter ini.
+     */
+    bool matches(const SensorSample& sample) const;
+};
+
+/**
+ * ClientSession -- State satu client WebSocket
+ *
+ * @tparam Handle Tipe handle koneksi milik backend
+ *                (server::connection_ptr untuk websocketpp, pointer socket untuk uWS)
+ */
+template <typename Handle>
+struct ClientSession {
+    const void* key = nullptr;   // Identitas unik selama koneksi hidup (alamat koneksi)
+    Handle handle{};             // Handle untuk mengirim data ke client
+    SubscriptionFilter filter;   // Filter langganan saat ini
+    WsPayloadFormat format = WsPayloadFormat::JSON;  // Dipilih saat handshake (subprotocol)
+    bool deflate = false;        // true = menerima frame permessage-deflate bersama
+
+    /// Counter + antrian conflation (tetap sama saat filter diganti)
+    std::shared_ptr<ClientOutbound> outbound = std::make_shared<ClientOutbound>();
+};
+
+namespace utils {
+    /**
+     * Parse pesan subscribe/unsubscribe dari client (format: lihat atas).
+     * Nama lokasi hanya DICARI di StringInterner::global() (find, bukan
+     * intern): string dari client tidak pernah masuk tabel global. Lokasi
+     * yang belum pernah dilaporkan sensor disimpan di location_names.
+     *
+     * @param message Pesan text dari client
+     * @param filter  [out] Filter hasil parse (hanya diubah jika sukses)
+     * @param error   [out] Alasan gagal (untuk dibalas ke client)
+     * @return true jika pesan valid
+     */
+    bool parse_subscription(const std::string& message, SubscriptionFilter& filter, std::string& error);
+
+    /**
+     * Pesan balasan ke client setelah subscribe/unsubscribe.
+     * Contoh: {"type":"subscribed","sensor_ids":2,"locations":1,"predicates":0}
+     */
+    std::string subscription_ack_json(const SubscriptionFilter& filter);
+
+    /**
+     * Pesan error ke client. Contoh: {"type":"error","message":"..."}
+     */
+    std::string subscription_error_json(const std::string& error);
+}
@@ -0,0 +1,63 @@
+#pragma once
+#include "pipeline/sensor_sample.h"
+#include <absl/types/span.h>
+#include <cstdint>
+#include <string>
+
+/**
+ * IWsServer Interface (Pure Virtual)
+ *
+ * Kontrak untuk backend WebSocket server. WebSocketAdapter hanya bergantung
+ * pada interface ini, sehingga implementasi server bisa dipilih saat startup
+ * (WS_BACKEND di app.cpp) tanpa mengubah adapter atau BridgeManager.
+ *
+ * Concrete implementations dalam project ini:
+ *   IWsServer (interface)
+ *       -> WsServer  : websocketpp + ASIO (default)
+ *       -> UwsServer : uWebSockets, pub/sub topic dengan satu event loop per thread
+ */
+class IWsServer {
+public:
+    virtual ~IWsServer() = default;
+
+    /**
+     * Jalankan server di port tertentu.
+     * BLOCKING -- tidak return sampai server berhenti.
+     * @param port Port number untuk listening
+     */
+    virtual void run(uint16_t port) = 0;
+
+    /**
+     * Broadcast pesan text (JSON data sensor) ke SEMUA client yang terhubung.
+     * Harus thread-safe: dipanggil dari thread worker bridge.
+     * @param message String yang akan dikirim
+     */
+    virtual void broadcast(const std::string& message) = 0;
+
+    /**
+     * Kirim JSON satu data sensor HANYA ke client yang filter langganannya
+     * cocok dengan data tersebut (lihat client_session.h). Client yang
+     * tidak pernah mengirim pesan subscribe menerima semua data.
+     * Client subprotocol protobuf (payload_format.h) menerima SensorRequest
+     * binary yang di-encode backend dari `sample`, bukan `message`.
+     * @param sample  Data sensor (untuk dicocokkan dengan filter)
+     * @param message JSON data sensor yang sudah diserialisasi
+     */
+    virtual void publish(const SensorSample& sample, const std::string& message) = 0;
+
+    /**
+     * Kirim satu micro-batch: setiap client menerima SATU text frame berisi
+     * JSON array dari data batch yang cocok dengan filter-nya (urutan batch
+     * dipertahankan). Client yang tidak cocok dengan data mana pun tidak
+     * menerima frame. Client protobuf menerima SensorBatch binary.
+     * @param samples  Data sensor (untuk dicocokkan dengan filter)
+     * @param messages JSON setiap data; messages[i] milik samples[i]
+     */
+    virtual void publish_batch(absl::Span<const SensorSample> samples,
+                               absl::Span<const std::string> messages) = 0;
+
+    /**
+     * Nama backend (untuk logging).
+     */
+    virtual std::string backend_name() const = 0;
+};
@@ -0,0 +1,129 @@
+#pragma once
+#include "pipeline/sensor_sample.h"
+#include "utils/json_helper.h"
+#include "utils/sensor_batch.h"
+#include "sensor.pb.h"
+#include <absl/types/span.h>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * payload_format.h -- Format payload data sensor per client WebSocket
+ *
+ * Client memilih format saat handshake lewat header Sec-WebSocket-Protocol:
+ *
+ *   new WebSocket(url)                          -> JSON (default, text frame)
+ *   new WebSocket(url, ["iot.sensor.json"])     -> JSON (text frame)
+ *   new WebSocket(url, ["iot.sensor.protobuf"]) -> protobuf (binary frame)
+ *
+ * Subprotocol protobuf (proto/sensor.proto):
+ *   - satu data per frame         -> iot::SensorRequest
+ *   - micro-batch (WS_BATCH_MODE) -> iot::SensorBatch (format kolom)
+ *   - snapshot saat connect       -> iot::SensorBatch (JSON: array)
+ *   Pesan kontrol (ack/error subscribe, broadcast biasa) tetap text JSON.
+ *
+ * Jika client menawarkan beberapa subprotocol, yang pertama dikenali
+ * dipakai (urutan preferensi client).
+ */
+enum class WsPayloadFormat {
+    JSON,      // Text frame, utils::sensor_to_json()
+    PROTOBUF   // Binary frame, iot::SensorRequest / iot::SensorBatch
+};
+
+namespace utils {
+    constexpr const char* kJsonSubprotocol = "iot.sensor.json";
+    constexpr const char* kProtobufSubprotocol = "iot.sensor.protobuf";
+
+    /**
+     * Pilih subprotocol dari daftar yang ditawarkan client.
+     * @param requested Subprotocol yang ditawarkan (urutan preferensi client)
+     * @param selected  [out] Subprotocol terpilih (tidak diubah jika tidak ada yang dikenali)
+     * @return true jika ada subprotocol yang dikenali
+     */
+    inline bool select_subprotocol(const std::vector<std::string>& requested, std::string& selected) {
+        for (const auto& protocol : requested) {
+            if (protocol == kJsonSubprotocol || protocol == kProtobufSubprotocol) {
+                selected = protocol;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Pecah nilai header Sec-WebSocket-Protocol ("a, b") menjadi daftar.
+     * (websocketpp sudah melakukannya sendiri; dipakai backend uWS.)
+     */
+    inline std::vector<std::string> split_subprotocols(std::string_view header) {
+        std::vector<std::string> out;
+        while (!header.empty()) {
+            size_t comma = header.find(',');
+            std::string_view item = header.substr(0, comma);
+            while (!item.empty() && item.front() == ' ') {
+                item.remove_prefix(1);
+            }
+            while (!item.empty() && item.back() == ' ') {
+                item.remove_suffix(1);
+            }
+            if (!item.empty()) {
+                out.emplace_back(item);
+            }
+            if (comma == std::string_view::npos) {
+                break;
+            }
+            header.remove_prefix(comma + 1);
+        }
+        return out;
+    }
+
+    /**
+     * Format payload untuk subprotocol yang terpilih saat handshake
+     * (kosong / tidak dikenal = JSON).
+     */
+    inline WsPayloadFormat payload_format_from_subprotocol(const std::string& selected) {
+        return selected == kProtobufSubprotocol ? WsPayloadFormat::PROTOBUF : WsPayloadFormat::JSON;
+    }
+
+    /**
+     * Serialisasi satu data sensor ke iot::SensorRequest (binary protobuf).
+     */
+    inline std::string sensor_to_protobuf(const SensorSample& sample) {
+        iot::SensorRequest request;
+        to_request(sample, &request);
+        return request.SerializeAsString();
+    }
+
+    /**
+     * Serialisasi micro-batch ke iot::SensorBatch (binary protobuf).
+     * @param samples Seluruh data batch
+     * @param indices Posisi data yang disertakan (urut); semua data jika kosong
+     */
+    inline std::string sensors_to_protobuf_batch(absl::Span<const SensorSample> samples,
+                                                 absl::Span<const uint32_t> indices = {}) {
+        iot::SensorBatch batch;
+        encode_sensor_batch(samples, indices, &batch);
+        return batch.SerializeAsString();
+    }
+
+    /**
+     * Serialisasi banyak data menjadi SATU payload sesuai format client:
+     * JSON array (sama seperti frame micro-batch) atau SensorBatch.
+     * Dipakai untuk snapshot nilai terakhir saat client connect.
+     */
+    inline std::string samples_payload(absl::Span<const SensorSample> samples, WsPayloadFormat format) {
+        if (format == WsPayloadFormat::PROTOBUF) {
+            return sensors_to_protobuf_batch(samples);
+        }
+        // JSON array ditulis langsung oleh encoder streaming (tanpa string per data)
+        JsonEncoder& encoder = JsonEncoder::local();
+        encoder.reset();
+        encoder.writer.StartArray();
+        for (const auto& sample : samples) {
+            write_sensor_json(encoder, sample);
+        }
+        encoder.writer.EndArray();
+        return std::string(encoder.view());
+    }
+}
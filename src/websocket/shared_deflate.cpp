@@ -0,0 +1,113 @@
+/**
+ * shared_deflate.cpp -- Implementasi SharedDeflate (lihat shared_deflate.h)
+ *
+ * Library yang digunakan: zlib (raw deflate, windowBits = -15)
+ */
+#include "shared_deflate.h"
+#include <zlib.h>
+#include <algorithm>
+#include <spdlog/spdlog.h>
+
+namespace {
+/**
+ * z_stream milik satu thread, diinisialisasi sekali lalu di-reset per pesan
+ * (deflateReset jauh lebih murah daripada deflateInit2 + deflateEnd).
+ */
+struct ThreadDeflater {
+    z_stream stream{};
+    int level = -1;
+    bool ready = false;
+
+    ~ThreadDeflater() {
+        if (ready) {
+            deflateEnd(&stream);
+        }
+    }
+
+    /// Pastikan stream siap untuk level ini
+    bool prepare(int wanted_level) {
+        if (ready && level == wanted_level) {
+            return deflateReset(&stream) == Z_OK;
+        }
+        if (ready) {
+            deflateEnd(&stream);
+            ready = false;
+        }
+        stream = z_stream{};
+        // windowBits negatif = raw deflate (tanpa header zlib), 15 = window penuh
+        if (deflateInit2(&stream, wanted_level, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+            return false;
+        }
+        level = wanted_level;
+        ready = true;
+        return true;
+    }
+};
+}  // namespace
+
+SharedDeflate::SharedDeflate(const WsCompressionConfig& config) : config_(config) {
+    config_.level = std::clamp(config_.level, 1, 9);
+}
+
+/**
+ * Client yang meminta server_max_window_bits < 15 tidak bisa men-decode
+ * frame bersama (dikompresi dengan window 15 bit); client itu tetap
+ * menerima frame tanpa kompresi.
+ */
+bool SharedDeflate::accepts_shared_frames(std::string_view response_extensions) {
+    if (response_extensions.find("permessage-deflate") == std::string_view::npos) {
+        return false;
+    }
+    constexpr std::string_view kWindowBits = "server_max_window_bits=";
+    size_t pos = response_extensions.find(kWindowBits);
+    if (pos == std::string_view::npos) {
+        return true;
+    }
+    std::string_view value = response_extensions.substr(pos + kWindowBits.size());
+    return value.substr(0, 2) == "15";
+}
+
+/**
+ * Kompresi satu pesan dengan stream baru (tanpa context takeover).
+ *
+ * Proses:
+ *   1. Reset z_stream thread ini
+ *   2. deflate(Z_SYNC_FLUSH) seluruh payload -- output diakhiri blok kosong
+ *      00 00 FF FF
+ *   3. Buang 4 byte penutup tersebut (client menambahkannya kembali saat
+ *      dekompresi, RFC 7692 7.2.2)
+ */
+bool SharedDeflate::compress(std::string_view payload, std::string& out) const {
+    if (!config_.enabled || payload.size() < config_.min_bytes) {
+        return false;
+    }
+
+    thread_local ThreadDeflater deflater;
+    if (!deflater.prepare(config_.level)) {
+        spdlog::warn("[WebSocket] permessage-deflate: failed to initialize zlib");
+        return false;
+    }
+
+    z_stream& stream = deflater.stream;
+    out.resize(deflateBound(&stream, static_cast<uLong>(payload.size())) + 8);
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(payload.data()));
+    stream.avail_in = static_cast<uInt>(payload.size());
+    stream.next_out = reinterpret_cast<Bytef*>(&out[0]);
+    stream.avail_out = static_cast<uInt>(out.size());
+
+    int ret = deflate(&stream, Z_SYNC_FLUSH);
+    if (ret != Z_OK || stream.avail_in != 0) {
+        return false;
+    }
+
+    size_t written = out.size() - stream.avail_out;
+    if (written < 4) {
+        return false;
+    }
+    written -= 4;  // 00 00 FF FF
+    if (written >= payload.size()) {
+        return false;  // Tidak menghemat apa pun
+    }
+    out.resize(written);
+    return true;
+}
@@ -0,0 +1,73 @@
+#pragma once
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+/**
+ * shared_deflate.h -- Kompresi permessage-deflate (RFC 7692) SEKALI per pesan
+ *
+ * Implementasi permessage-deflate biasa menyimpan satu z_stream per koneksi
+ * (context takeover): setiap pesan dikompresi ulang untuk setiap client.
+ * Untuk broadcast ke N client itu berarti N kali deflate payload yang sama.
+ *
+ * SharedDeflate mengompresi setiap pesan secara INDEPENDEN (stream di-reset
+ * per pesan, tanpa context takeover), sehingga hasilnya valid untuk SEMUA
+ * client yang menegosiasikan permessage-deflate dengan window server
+ * penuh (15 bit). RFC 7692 mengizinkan server tidak memakai context
+ * takeover walaupun tidak mengumumkan server_no_context_takeover.
+ *
+ * Konsekuensi: tanpa konteks antar pesan, rasio kompresi berasal dari
+ * pengulangan DI DALAM satu pesan -- paling efektif untuk frame micro-batch
+ * (JSON array dengan key dan lokasi berulang). Pesan di bawah min_bytes
+ * tidak dikompresi.
+ *
+ * Thread-safety: z_stream disimpan thread_local, jadi compress() boleh
+ * dipanggil dari beberapa thread sekaligus.
+ *
+ * Nilai dari environment variable (lihat create_ws_server() di app.cpp):
+ *   WS_COMPRESSION, WS_COMPRESSION_LEVEL, WS_COMPRESSION_MIN_BYTES
+ */
+
+/**
+ * Konfigurasi kompresi WebSocket.
+ */
+struct WsCompressionConfig {
+    bool enabled = false;     // WS_COMPRESSION: "shared" untuk mengaktifkan
+    int level = 6;            // Level zlib 1 (cepat) .. 9 (kecil)
+    size_t min_bytes = 256;   // Payload lebih kecil dari ini dikirim tanpa kompresi
+};
+
+class SharedDeflate {
+public:
+    explicit SharedDeflate(const WsCompressionConfig& config = {});
+
+    /**
+     * Kompresi satu payload menjadi isi frame permessage-deflate
+     * (raw deflate, tanpa 4 byte penutup 00 00 FF FF sesuai RFC 7692 7.2.1).
+     *
+     * @param payload Isi pesan asli
+     * @param out     [out] Payload terkompresi
+     * @return false jika kompresi nonaktif, payload terlalu kecil, hasilnya
+     *         tidak lebih kecil, atau zlib gagal -- kirim tanpa kompresi
+     */
+    bool compress(std::string_view payload, std::string& out) const;
+
+    bool enabled() const {
+        return config_.enabled;
+    }
+
+    /**
+     * Cek apakah hasil negosiasi permessage-deflate (header response
+     * Sec-WebSocket-Extensions) cocok dengan frame bersama: extension aktif
+     * dan window server tidak dibatasi di bawah 15 bit.
+     * @param response_extensions Nilai header Sec-WebSocket-Extensions dari server
+     */
+    static bool accepts_shared_frames(std::string_view response_extensions);
+
+    const WsCompressionConfig& config() const {
+        return config_;
+    }
+
+private:
+    WsCompressionConfig config_;
+};
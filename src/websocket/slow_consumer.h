@@ -0,0 +1,139 @@
+#pragma once
+#include <absl/container/flat_hash_map.h>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * slow_consumer.h -- Proteksi terhadap client WebSocket yang lambat
+ *
+ * Server hanya mengantrekan frame ke buffer kirim setiap koneksi. Jika satu
+ * client berhenti membaca (tab browser di-suspend, jaringan macet), buffer
+ * koneksi itu terus membesar tanpa batas. Dengan batas per koneksi
+ * (max_buffered_bytes), frame baru untuk client yang melewati batas
+ * diperlakukan sesuai policy:
+ *
+ *   - "drop_newest" : buang frame baru (client melewatkan data)
+ *   - "conflate"    : simpan HANYA data terbaru per sensor; dikirim saat
+ *                     buffer client sudah turun di bawah batas lagi (frame
+ *                     berikutnya untuk client itu, atau timer flush
+ *                     setiap conflate_flush_interval)
+ *   - "disconnect"  : tutup koneksi client (policy violation)
+ *
+ * Nilai dari environment variable (lihat create_ws_server() di app.cpp):
+ *   WS_MAX_BUFFERED_BYTES, WS_SLOW_CONSUMER_POLICY
+ */
+enum class SlowConsumerPolicy {
+    DROP_NEWEST,  // Buang frame baru
+    CONFLATE,     // Simpan data terbaru per sensor
+    DISCONNECT    // Putuskan client
+};
+
+/**
+ * Konfigurasi proteksi slow consumer.
+ */
+struct SlowConsumerConfig {
+    size_t max_buffered_bytes = 1024 * 1024;               // Batas buffer kirim per koneksi
+    SlowConsumerPolicy policy = SlowConsumerPolicy::DROP_NEWEST;
+    std::chrono::milliseconds conflate_flush_interval{50};  // Periode cek antrian conflation (CONFLATE)
+};
+
+/**
+ * ClientOutbound -- Counter + antrian conflation milik satu client
+ *
+ * Dibagi (shared_ptr) oleh semua versi ClientSession client tersebut,
+ * jadi counter tetap berlanjut saat filter langganan diganti.
+ */
+struct ClientOutbound {
+    std::atomic<uint64_t> sent{0};       // Frame yang diantrekan ke koneksi
+    std::atomic<uint64_t> dropped{0};    // Frame yang dibuang (termasuk yang ditimpa conflation)
+    std::atomic<uint64_t> conflated{0};  // Frame yang ditahan di antrian conflation
+    std::atomic<bool> has_pending{false};
+
+    /**
+     * Simpan payload terbaru untuk sensor ini (policy CONFLATE).
+     * Payload lama untuk sensor yang sama (jika ada) dihitung sebagai dropped.
+     */
+    void conflate(int32_t sensor_id, std::shared_ptr<const std::string> payload) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto result = pending_.insert_or_assign(sensor_id, std::move(payload));
+        if (!result.second) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+        conflated.fetch_add(1, std::memory_order_relaxed);
+        has_pending.store(true, std::memory_order_release);
+    }
+
+    /**
+     * Kirim semua payload yang tertahan (urutan tidak dijamin antar sensor).
+     * send dipanggil DI BAWAH lock antrian, jadi flush dari fan-out dan dari
+     * timer flush (WsServer) tidak pernah saling menyalip: payload lama
+     * tidak bisa terkirim setelah payload baru sensor yang sama.
+     * @param skip_sensor Sensor yang payload-nya akan segera digantikan data
+     *                    lebih baru (dibuang, bukan dikirim)
+     * @param send        fn(const std::string& payload)
+     * @return Jumlah payload yang dikirim
+     */
+    template <typename Send>
+    size_t flush_pending(std::optional<int32_t> skip_sensor, Send&& send) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        size_t count = 0;
+        for (auto& entry : pending_) {
+            if (entry.first == skip_sensor) {
+                dropped.fetch_add(1, std::memory_order_relaxed);
+                continue;
+            }
+            send(*entry.second);
+            ++count;
+        }
+        pending_.clear();
+        has_pending.store(false, std::memory_order_release);
+        sent.fetch_add(count, std::memory_order_relaxed);
+        return count;
+    }
+
+private:
+    std::mutex mutex_;
+    absl::flat_hash_map<int32_t, std::shared_ptr<const std::string>> pending_;  // sensor_id -> payload terbaru
+};
+
+namespace utils {
+    /**
+     * Parse string menjadi SlowConsumerPolicy.
+     *
+     * @param policy   String nama policy ("drop_newest", "conflate", "disconnect")
+     * @param fallback Policy default jika string tidak dikenali
+     */
+    inline SlowConsumerPolicy parse_slow_consumer_policy(const std::string& policy,
+                                                         SlowConsumerPolicy fallback) {
+        if (policy == "drop_newest") {
+            return SlowConsumerPolicy::DROP_NEWEST;
+        }
+        if (policy == "conflate") {
+            return SlowConsumerPolicy::CONFLATE;
+        }
+        if (policy == "disconnect") {
+            return SlowConsumerPolicy::DISCONNECT;
+        }
+        return fallback;
+    }
+
+    /**
+     * Nama policy untuk logging.
+     */
+    inline const char* slow_consumer_policy_name(SlowConsumerPolicy policy) {
+        switch (policy) {
+        case SlowConsumerPolicy::DROP_NEWEST: return "drop_newest";
+        case SlowConsumerPolicy::CONFLATE:    return "conflate";
+        case SlowConsumerPolicy::DISCONNECT:  return "disconnect";
+        }
+        return "unknown";
+    }
+}
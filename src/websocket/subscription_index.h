@@ -0,0 +1,267 @@
+#pragma once
+#include "utils/snapshot_cell.h"
+#include "websocket/client_session.h"
+#include <absl/container/flat_hash_map.h>
+#include <absl/types/span.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+/**
+ * subscription_index.h -- Inverted index sensor_id/location -> client
+ *
+ * Tanpa index, setiap data harus dicek ke SEMUA client. Dengan index,
+ * broadcast hanya menyentuh client yang memang berminat:
+ *
+ *   by_sensor[sensor_id]     -> client yang filter-nya menyebut sensor_id tsb
+ *   by_location[location_id] -> client yang filter-nya hanya menyebut lokasi
+ *   wildcard                 -> client tanpa sensor_id/lokasi (semua data,
+ *                               mungkin dengan predikat nilai), plus client
+ *                               yang menyebut lokasi yang belum dikenal
+ *                               (location_names, dicek per data)
+ *
+ * Setiap client hanya masuk SATU jenis bucket (sensor > lokasi > wildcard),
+ * jadi tidak ada duplikasi saat lookup; kriteria sisanya (lokasi, predikat)
+ * dicek dengan SubscriptionFilter::matches().
+ *
+ * Thread-safety (copy-on-write, sama seperti Observable):
+ *   - Reader mengambil Snapshot immutable dari utils::SnapshotCell: cache
+ *     per thread + satu load atomic, tanpa mutex.
+ *   - add/update/remove (jarang: connect, disconnect, pesan subscribe)
+ *     membangun ulang Snapshot dari daftar session lalu mem-publish-nya.
+ *
+ * @tparam Handle Tipe handle koneksi milik backend WebSocket
+ */
+template <typename Handle>
+class SubscriptionIndex {
+public:
+    using Session = ClientSession<Handle>;
+    using SessionPtr = std::shared_ptr<const Session>;
+    using SessionList = std::vector<SessionPtr>;
+
+    /**
+     * Index immutable hasil build. Aman dipakai dari banyak thread dan
+     * boleh disimpan (misalnya di-capture ke task strand) selama perlu.
+     */
+    class Snapshot {
+    public:
+        /**
+         * Panggil fn(session) untuk setiap client yang filter-nya cocok dengan data.
+         */
+        template <typename F>
+        void for_each_match(const SensorSample& sample, F&& fn) const {
+            for (const auto& session : wildcard_) {
+                if (session->filter.is_wildcard()) {
+                    fn(*session);
+                }
+            }
+            match_filtered(sample, fn);
+        }
+
+        /**
+         * Versi batch dari for_each_match(): panggil fn(session, indices)
+         * SEKALI per client yang cocok dengan minimal satu data, dengan
+         * indices = posisi data yang cocok di batch (urut naik).
+         *
+         * Client wildcard murni (tanpa kriteria) langsung menerima semua
+         * indeks tanpa lookup per data.
+         */
+        template <typename F>
+        void for_each_batch_match(absl::Span<const SensorSample> batch, F&& fn) const {
+            if (batch.empty()) {
+                return;
+            }
+
+            std::vector<uint32_t> all_indices(batch.size());
+            for (uint32_t i = 0; i < all_indices.size(); ++i) {
+                all_indices[i] = i;
+            }
+
+            absl::flat_hash_map<const Session*, std::vector<uint32_t>> matches;
+            std::vector<const Session*> order;  // Urutan client pertama kali cocok
+            for (uint32_t i = 0; i < batch.size(); ++i) {
+                match_filtered(batch[i], [&](const Session& session) {
+                    auto& indices = matches[&session];
+                    if (indices.empty()) {
+                        order.push_back(&session);
+                    }
+                    indices.push_back(i);
+                });
+            }
+
+            for (const auto& session : wildcard_) {
+                if (session->filter.is_wildcard()) {
+                    fn(*session, absl::Span<const uint32_t>(all_indices));
+                }
+            }
+            for (const Session* session : order) {
+                fn(*session, absl::Span<const uint32_t>(matches[session]));
+            }
+        }
+
+        /**
+         * Panggil fn(session) untuk SEMUA client yang terhubung (tanpa filter),
+         * termasuk yang sedang unsubscribe.
+         */
+        template <typename F>
+        void for_each(F&& fn) const {
+            for (const auto& session : all_) {
+                fn(*session);
+            }
+        }
+
+        /// Jumlah client yang terhubung
+        size_t size() const {
+            return all_.size();
+        }
+
+        bool empty() const {
+            return all_.empty();
+        }
+
+    private:
+        friend class SubscriptionIndex;
+
+        /**
+         * Client dengan kriteria (bucket sensor/lokasi + wildcard berpredikat)
+         * yang cocok dengan data. Client wildcard murni ditangani pemanggil.
+         */
+        template <typename F>
+        void match_filtered(const SensorSample& sample, F&& fn) const {
+            auto by_sensor = by_sensor_.find(sample.sensor_id);
+            if (by_sensor != by_sensor_.end()) {
+                for (const auto& session : by_sensor->second) {
+                    if (session->filter.matches(sample)) {
+                        fn(*session);
+                    }
+                }
+            }
+
+            auto by_location = by_location_.find(sample.location_id);
+            if (by_location != by_location_.end()) {
+                for (const auto& session : by_location->second) {
+                    if (session->filter.matches(sample)) {
+                        fn(*session);
+                    }
+                }
+            }
+
+            for (const auto& session : wildcard_) {
+                if (!session->filter.is_wildcard() && session->filter.matches(sample)) {
+                    fn(*session);
+                }
+            }
+        }
+
+        absl::flat_hash_map<int32_t, SessionList> by_sensor_;
+        absl::flat_hash_map<uint32_t, SessionList> by_location_;
+        SessionList wildcard_;
+        SessionList all_;
+    };
+
+    SubscriptionIndex() = default;
+    SubscriptionIndex(const SubscriptionIndex&) = delete;
+    SubscriptionIndex& operator=(const SubscriptionIndex&) = delete;
+
+    /**
+     * Daftarkan client baru dengan filter default (semua data).
+     * @param key    Identitas unik koneksi (alamat objek koneksi)
+     * @param handle Handle untuk mengirim data
+     * @param format  Format payload hasil negosiasi subprotocol
+     * @param deflate true jika client menerima frame permessage-deflate bersama
+     */
+    void add(const void* key, Handle handle, WsPayloadFormat format = WsPayloadFormat::JSON,
+             bool deflate = false) {
+        auto session = std::make_shared<Session>();
+        session->key = key;
+        session->handle = std::move(handle);
+        session->format = format;
+        session->deflate = deflate;
+
+        std::lock_guard<std::mutex> lock(writer_mutex_);
+        sessions_[key] = std::move(session);
+        rebuild_locked();
+    }
+
+    /**
+     * Ganti filter langganan client.
+     * @return false jika client tidak dikenal (sudah terputus)
+     */
+    bool update(const void* key, const SubscriptionFilter& filter) {
+        std::lock_guard<std::mutex> lock(writer_mutex_);
+        auto it = sessions_.find(key);
+        if (it == sessions_.end()) {
+            return false;
+        }
+        auto session = std::make_shared<Session>(*it->second);  // Session juga immutable
+        session->filter = filter;
+        it->second = std::move(session);
+        rebuild_locked();
+        return true;
+    }
+
+    /**
+     * Hapus client (saat disconnect).
+     * @return Session yang dihapus (untuk statistik), atau nullptr jika tidak dikenal
+     */
+    SessionPtr remove(const void* key) {
+        std::lock_guard<std::mutex> lock(writer_mutex_);
+        auto it = sessions_.find(key);
+        if (it == sessions_.end()) {
+            return nullptr;
+        }
+        SessionPtr removed = std::move(it->second);
+        sessions_.erase(it);
+        rebuild_locked();
+        return removed;
+    }
+
+    /**
+     * Ambil snapshot index saat ini (tanpa mutex).
+     * Referensi valid sampai thread ini memanggil snapshot() lagi; salin
+     * shared_ptr-nya untuk dipakai di thread/task lain.
+     */
+    const std::shared_ptr<const Snapshot>& snapshot() const {
+        return snapshot_.read();
+    }
+
+private:
+    /**
+     * Bangun ulang Snapshot dari sessions_ lalu publish. Dipanggil di bawah writer_mutex_.
+     */
+    void rebuild_locked() {
+        auto index = std::make_shared<Snapshot>();
+        index->all_.reserve(sessions_.size());
+
+        for (const auto& entry : sessions_) {
+            const SessionPtr& session = entry.second;
+            const SubscriptionFilter& filter = session->filter;
+            index->all_.push_back(session);
+
+            if (!filter.active) {
+                continue;  // Unsubscribe: tidak masuk index
+            }
+            if (!filter.sensor_ids.empty()) {
+                for (int32_t id : filter.sensor_ids) {
+                    index->by_sensor_[id].push_back(session);
+                }
+            } else if (!filter.location_ids.empty() && filter.location_names.empty()) {
+                for (uint32_t id : filter.location_ids) {
+                    index->by_location_[id].push_back(session);
+                }
+            } else {
+                index->wildcard_.push_back(session);
+            }
+        }
+
+        snapshot_.store(std::move(index));
+    }
+
+    std::mutex writer_mutex_;                                   // Mutex untuk writer saja
+    absl::flat_hash_map<const void*, SessionPtr> sessions_;     // Semua session (sumber kebenaran)
+
+    utils::SnapshotCell<Snapshot> snapshot_;  // Snapshot index (reader tanpa mutex)
+};
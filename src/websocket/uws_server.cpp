@@ -0,0 +1,476 @@
+/**
+ * uws_server.cpp -- Implementasi WebSocket Server berbasis uWebSockets
+ *
+ * Backend alternatif untuk IWsServer (WS_BACKEND=uws). Library yang digunakan:
+ *   - uWebSockets : WebSocket/HTTP server dengan pub/sub topic bawaan
+ *   - uSockets    : event loop + socket layer di bawah uWebSockets
+ */
+#include "uws_server.h"
+#include "websocket/subscription_index.h"
+#include "utils/json_helper.h"
+#include <uWebSockets/App.h>
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <optional>
+#include <string_view>
+#include <thread>
+
+namespace {
+/**
+ * Data per koneksi uWS.
+ */
+struct PerSocketData {
+    bool filtered = false;  // true = client ada di SubscriptionIndex (bukan di topic)
+    WsPayloadFormat format = WsPayloadFormat::JSON;  // Dipilih saat upgrade (subprotocol)
+
+    /// Counter + antrian conflation untuk pengiriman langsung (client dengan filter)
+    std::shared_ptr<ClientOutbound> outbound = std::make_shared<ClientOutbound>();
+};
+
+using Socket = uWS::WebSocket<false, true, PerSocketData>;
+using Index = SubscriptionIndex<Socket*>;
+
+// Batas ukuran pesan masuk dari client (client hanya menerima data)
+constexpr unsigned int kMaxPayloadLength = 16 * 1024;
+
+// Timeout koneksi idle (detik); uWS mengirim ping otomatis sebelum timeout
+constexpr unsigned short kIdleTimeout = 120;
+
+/// Opcode frame data sensor untuk format payload client
+uWS::OpCode opcode_for(WsPayloadFormat format) {
+    return format == WsPayloadFormat::PROTOBUF ? uWS::OpCode::BINARY : uWS::OpCode::TEXT;
+}
+
+/// Topic pub/sub untuk format payload client
+const char* topic_for(WsPayloadFormat format) {
+    return format == WsPayloadFormat::PROTOBUF ? UwsServer::kBinaryTopic : UwsServer::kTopic;
+}
+
+/**
+ * Kirim semua payload yang tertahan conflation (jika buffer sudah longgar).
+ * @param skip_sensor Sensor yang akan segera dikirim data barunya (payload lamanya dibuang)
+ */
+void flush_pending(Socket* ws, ClientOutbound& outbound, std::optional<int32_t> skip_sensor) {
+    const uWS::OpCode opcode = opcode_for(ws->getUserData()->format);
+    outbound.flush_pending(skip_sensor, [ws, opcode](const std::string& payload) {
+        ws->send(payload, opcode);
+    });
+}
+
+/**
+ * Kirim langsung ke satu client dengan proteksi slow consumer
+ * (logika sama dengan WsServer::deliver(), memakai getBufferedAmount() uWS).
+ *
+ * @param ws      Socket tujuan (dipanggil di thread loop pemiliknya)
+ * @param message Payload (format client)
+ * @param opcode  TEXT (JSON) atau BINARY (protobuf)
+ * @param sample  Data sensor asal payload, nullptr untuk broadcast biasa
+ * @param config  Batas buffer + policy
+ */
+void deliver(Socket* ws, const std::string& message, uWS::OpCode opcode, const SensorSample* sample,
+             const SlowConsumerConfig& config) {
+    ClientOutbound& outbound = *ws->getUserData()->outbound;
+
+    if (ws->getBufferedAmount() < config.max_buffered_bytes) {
+        if (outbound.has_pending.load(std::memory_order_acquire)) {
+            std::optional<int32_t> superseded;
+            if (sample) {
+                superseded = sample->sensor_id;
+            }
+            flush_pending(ws, outbound, superseded);
+        }
+        ws->send(message, opcode);
+        outbound.sent.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    switch (config.policy) {
+    case SlowConsumerPolicy::DROP_NEWEST:
+        if (outbound.dropped.fetch_add(1, std::memory_order_relaxed) == 0) {
+            spdlog::warn("[WebSocket] Slow uWS client: send buffer over {} bytes, dropping frames",
+                         config.max_buffered_bytes);
+        }
+        break;
+
+    case SlowConsumerPolicy::CONFLATE:
+        if (sample) {
+            outbound.conflate(sample->sensor_id, std::make_shared<const std::string>(message));
+        } else {
+            outbound.dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+        break;
+
+    case SlowConsumerPolicy::DISCONNECT:
+        outbound.dropped.fetch_add(1, std::memory_order_relaxed);
+        spdlog::warn("[WebSocket] Slow uWS client: send buffer over {} bytes, disconnecting",
+                     config.max_buffered_bytes);
+        ws->end(1008, "slow consumer");  // 1008 = policy violation
+        break;
+    }
+}
+
+/**
+ * Kirim frame micro-batch ke satu client (lihat WsServer::deliver_batch()):
+ * policy CONFLATE dengan buffer penuh menyimpan setiap data sebagai data
+ * terbaru sensornya (dalam format client); selain itu sama seperti deliver().
+ */
+void deliver_batch(Socket* ws, const std::string& payload, const std::vector<SensorSample>& samples,
+                   const std::vector<std::string>& messages, absl::Span<const uint32_t> indices,
+                   const SlowConsumerConfig& config) {
+    const WsPayloadFormat format = ws->getUserData()->format;
+    if (config.policy != SlowConsumerPolicy::CONFLATE ||
+        ws->getBufferedAmount() < config.max_buffered_bytes) {
+        deliver(ws, payload, opcode_for(format), nullptr, config);
+        return;
+    }
+
+    ClientOutbound& outbound = *ws->getUserData()->outbound;
+    for (uint32_t i : indices) {
+        auto single = format == WsPayloadFormat::PROTOBUF
+                          ? std::make_shared<const std::string>(utils::sensor_to_protobuf(samples[i]))
+                          : std::make_shared<const std::string>(messages[i]);
+        outbound.conflate(samples[i].sensor_id, std::move(single));
+    }
+}
+}  // namespace
+
+/**
+ * Constructor UwsServer.
+ * App dan loop belum dibuat di sini: uWS mengikat App ke loop milik
+ * thread yang membuatnya, jadi semuanya dibuat di run_loop().
+ *
+ * @param threads       Jumlah thread event loop (0 dianggap 1)
+ * @param slow_consumer Batas buffer kirim per koneksi + policy
+ * @param snapshot_on_connect true = kirim nilai terakhir semua sensor ke client baru
+ */
+UwsServer::UwsServer(size_t threads, const SlowConsumerConfig& slow_consumer, bool snapshot_on_connect)
+    : threads_(threads == 0 ? 1 : threads), slow_consumer_(slow_consumer),
+      snapshot_on_connect_(snapshot_on_connect) {
+}
+
+/**
+ * Jalankan semua event loop.
+ * Thread pemanggil menjalankan loop ke-0; loop lainnya di thread tambahan
+ * yang di-join sebelum return.
+ *
+ * @param port Port number untuk listening
+ */
+void UwsServer::run(uint16_t port) {
+    std::vector<std::thread> pool;
+    for (size_t i = 1; i < threads_; ++i) {
+        pool.emplace_back(&UwsServer::run_loop, this, port, i);
+    }
+    run_loop(port, 0);
+    for (auto& t : pool) {
+        t.join();
+    }
+}
+
+/**
+ * Isi satu thread event loop.
+ *
+ * Urutan:
+ *   1. Buat uWS::App (terikat ke uWS::Loop thread ini)
+ *   2. Pasang handler WebSocket: upgrade memilih subprotocol (format),
+ *      client baru langsung subscribe topic format-nya, pesan subscribe
+ *      memindahkan client antara topic dan index loop ini
+ *   3. listen() di port (SO_REUSEPORT -- semua loop berbagi port)
+ *   4. Daftarkan Worker (copy-on-write) agar broadcast() bisa menjangkau loop ini
+ *   5. run() -- event loop (BLOCKING)
+ *   6. Setelah loop berhenti: tandai worker mati dan hapus dari daftar
+ *
+ * @param port  Port number untuk listening
+ * @param index Nomor loop (untuk logging)
+ */
+void UwsServer::run_loop(uint16_t port, size_t index) {
+    try {
+        uWS::App app;
+        Index subscriptions;  // Client dengan filter di loop ini (hanya diakses thread loop)
+        const SlowConsumerConfig config = slow_consumer_;
+
+        // Client di topic: uWS sendiri membuang pesan untuk subscriber yang
+        // backpressure-nya melewati batas, atau menutup koneksinya (disconnect)
+        uWS::App::WebSocketBehavior<PerSocketData> behavior;
+        behavior.compression = uWS::DISABLED;
+        behavior.maxPayloadLength = kMaxPayloadLength;
+        behavior.maxBackpressure = static_cast<unsigned int>(config.max_buffered_bytes);
+        behavior.closeOnBackpressureLimit = (config.policy == SlowConsumerPolicy::DISCONNECT);
+        behavior.idleTimeout = kIdleTimeout;
+        behavior.upgrade = [](auto* res, auto* req, auto* context) {
+            // Pilih subprotocol yang ditawarkan client (kosong = JSON, header tidak dikirim)
+            std::string selected;
+            utils::select_subprotocol(utils::split_subprotocols(req->getHeader("sec-websocket-protocol")),
+                                      selected);
+            PerSocketData data;
+            data.format = utils::payload_format_from_subprotocol(selected);
+            res->template upgrade<PerSocketData>(std::move(data),
+                                                 req->getHeader("sec-websocket-key"),
+                                                 selected,
+                                                 req->getHeader("sec-websocket-extensions"),
+                                                 context);
+        };
+        behavior.open = [this](auto* ws) {
+            const WsPayloadFormat format = ws->getUserData()->format;
+            ws->subscribe(topic_for(format));  // Semua client menerima broadcast data sensor
+            if (format == WsPayloadFormat::PROTOBUF) {
+                binary_connections_.fetch_add(1, std::memory_order_relaxed);
+            }
+            connections_.fetch_add(1, std::memory_order_relaxed);
+
+            if (snapshot_on_connect_) {
+                // Nilai terakhir semua sensor dalam SATU frame
+                std::vector<SensorSample> latest;
+                latest_.snapshot(latest);
+                if (!latest.empty()) {
+                    ws->send(utils::samples_payload(latest, format), opcode_for(format));
+                }
+            }
+        };
+        behavior.message = [&subscriptions](auto* ws, std::string_view message, uWS::OpCode op) {
+            if (op != uWS::OpCode::TEXT) {
+                return;
+            }
+            SubscriptionFilter filter;
+            std::string error;
+            if (!utils::parse_subscription(std::string(message), filter, error)) {
+                ws->send(utils::subscription_error_json(error), uWS::OpCode::TEXT);
+                return;
+            }
+
+            PerSocketData* data = ws->getUserData();
+            if (filter.is_wildcard()) {
+                // Kembali ke jalur pub/sub topic
+                if (data->filtered) {
+                    subscriptions.remove(ws);
+                    data->filtered = false;
+                }
+                ws->subscribe(topic_for(data->format));
+            } else {
+                if (!data->filtered) {
+                    ws->unsubscribe(topic_for(data->format));
+                    subscriptions.add(ws, ws, data->format);
+                    data->filtered = true;
+                }
+                subscriptions.update(ws, filter);
+            }
+            ws->send(utils::subscription_ack_json(filter), uWS::OpCode::TEXT);
+        };
+        behavior.drain = [config](auto* ws) {
+            // Buffer mulai kosong: kirim data terbaru yang tertahan conflation
+            ClientOutbound& outbound = *ws->getUserData()->outbound;
+            if (outbound.has_pending.load(std::memory_order_acquire) &&
+                ws->getBufferedAmount() < config.max_buffered_bytes) {
+                flush_pending(ws, outbound, std::nullopt);
+            }
+        };
+        behavior.close = [this, &subscriptions](auto* ws, int /*code*/, std::string_view /*message*/) {
+            PerSocketData* data = ws->getUserData();
+            if (data->filtered) {
+                subscriptions.remove(ws);
+            }
+            if (data->outbound->dropped.load(std::memory_order_relaxed) > 0) {
+                spdlog::info("[WebSocket] Slow uWS client closed (sent={}, dropped={}, conflated={})",
+                             data->outbound->sent.load(std::memory_order_relaxed),
+                             data->outbound->dropped.load(std::memory_order_relaxed),
+                             data->outbound->conflated.load(std::memory_order_relaxed));
+            }
+            if (data->format == WsPayloadFormat::PROTOBUF) {
+                binary_connections_.fetch_sub(1, std::memory_order_relaxed);
+            }
+            connections_.fetch_sub(1, std::memory_order_relaxed);
+        };
+
+        bool listening = false;
+        app.ws<PerSocketData>("/*", std::move(behavior))
+            .listen(port, [&listening](auto* listen_socket) {
+                listening = (listen_socket != nullptr);
+            });
+
+        if (!listening) {
+            spdlog::error("[WebSocket] uWS loop {} failed to listen on port {}", index, port);
+            return;
+        }
+
+        auto worker = std::make_shared<Worker>();
+        worker->loop = uWS::Loop::get();
+        worker->send_all = [&app, &subscriptions, config](const std::string& message) {
+            // Broadcast biasa (bukan data sensor): text untuk semua format
+            app.publish(kTopic, message, uWS::OpCode::TEXT);
+            app.publish(kBinaryTopic, message, uWS::OpCode::TEXT);
+            subscriptions.snapshot()->for_each([&](const Index::Session& session) {
+                deliver(session.handle, message, uWS::OpCode::TEXT, nullptr, config);
+            });
+        };
+        worker->send_matching = [&app, &subscriptions, config](const SensorSample& sample,
+                                                             const std::string& message,
+                                                             const std::string* binary) {
+            // Client tanpa filter
+            app.publish(kTopic, message, uWS::OpCode::TEXT);
+            if (binary) {
+                app.publish(kBinaryTopic, *binary, uWS::OpCode::BINARY);
+            }
+            subscriptions.snapshot()->for_each_match(sample, [&](const Index::Session& session) {
+                if (session.format == WsPayloadFormat::PROTOBUF) {
+                    if (binary) {
+                        deliver(session.handle, *binary, uWS::OpCode::BINARY, &sample, config);
+                    }
+                    return;
+                }
+                deliver(session.handle, message, uWS::OpCode::TEXT, &sample, config);
+            });
+        };
+        worker->send_batch = [&app, &subscriptions, config](const Batch& batch) {
+            // Client tanpa filter
+            app.publish(kTopic, batch.full_payload, uWS::OpCode::TEXT);
+            if (batch.has_binary) {
+                app.publish(kBinaryTopic, batch.full_binary, uWS::OpCode::BINARY);
+            }
+            subscriptions.snapshot()->for_each_batch_match(
+                batch.samples, [&](const Index::Session& session, absl::Span<const uint32_t> indices) {
+                    const bool binary = (session.format == WsPayloadFormat::PROTOBUF);
+                    if (binary && !batch.has_binary) {
+                        return;  // Client protobuf baru terhubung setelah batch dibangun
+                    }
+                    if (indices.size() == batch.samples.size()) {
+                        deliver_batch(session.handle, binary ? batch.full_binary : batch.full_payload,
+                                      batch.samples, batch.messages, indices, config);
+                        return;
+                    }
+                    deliver_batch(session.handle,
+                                  binary ? utils::sensors_to_protobuf_batch(batch.samples, indices)
+                                         : utils::join_json_array(batch.messages, indices),
+                                  batch.samples, batch.messages, indices, config);
+                });
+        };
+
+        {
+            std::lock_guard<std::mutex> lock(writer_mutex_);
+            auto updated = std::make_shared<WorkerList>(*workers_.load());
+            updated->push_back(worker);
+            workers_.store(std::move(updated));
+        }
+
+        spdlog::info("[WebSocket] uWS loop {} listening on port {}", index, port);
+        app.run();  // Event loop (BLOCKING)
+
+        // Loop berhenti: publish yang masih di-defer tidak boleh menyentuh App lagi
+        worker->alive = false;
+        {
+            std::lock_guard<std::mutex> lock(writer_mutex_);
+            auto updated = std::make_shared<WorkerList>(*workers_.load());
+            updated->erase(std::remove(updated->begin(), updated->end(), worker), updated->end());
+            workers_.store(std::move(updated));
+        }
+    } catch (const std::exception& e) {
+        spdlog::error("[WebSocket] uWS loop {} error: {}", index, e.what());
+    }
+}
+
+const UwsServer::WorkerList& UwsServer::snapshot() const {
+    return *workers_.read();
+}
+
+/**
+ * Broadcast pesan ke semua client di semua loop.
+ *
+ * uWS tidak thread-safe: App::publish() hanya boleh dipanggil dari thread
+ * loop pemilik App. Karena itu publish di-defer ke setiap loop; payload
+ * disalin SEKALI ke shared_ptr yang dipakai bersama oleh semua loop, dan
+ * publish() sendiri membangun frame sekali untuk semua subscriber loop itu.
+ *
+ * @param message String yang akan dikirim (JSON data sensor)
+ */
+void UwsServer::broadcast(const std::string& message) {
+    const WorkerList& workers = snapshot();  // Snapshot immutable -- aman diiterasi tanpa lock
+    if (workers.empty()) {
+        return;  // Server belum jalan
+    }
+
+    auto payload = std::make_shared<const std::string>(message);
+    for (const auto& worker : workers) {
+        worker->loop->defer([worker, payload]() {
+            if (worker->alive) {
+                worker->send_all(*payload);
+            }
+        });
+    }
+}
+
+/**
+ * Kirim JSON data sensor ke client yang filter-nya cocok.
+ * Di setiap loop: client tanpa filter lewat App::publish() topic, client
+ * dengan filter lewat SubscriptionIndex loop tersebut. Payload protobuf
+ * dibangun sekali di sini, hanya jika ada client protobuf.
+ *
+ * @param sample  Data sensor (kunci lookup index)
+ * @param message JSON data sensor
+ */
+void UwsServer::publish(const SensorSample& sample, const std::string& message) {
+    if (snapshot_on_connect_) {
+        latest_.upsert(sample);
+    }
+
+    const WorkerList& workers = snapshot();
+    if (workers.empty()) {
+        return;
+    }
+
+    auto payload = std::make_shared<const std::string>(message);
+    std::shared_ptr<const std::string> binary;
+    if (binary_connections_.load(std::memory_order_relaxed) > 0) {
+        binary = std::make_shared<const std::string>(utils::sensor_to_protobuf(sample));
+    }
+    for (const auto& worker : workers) {
+        worker->loop->defer([worker, payload, binary, sample]() {
+            if (worker->alive) {
+                worker->send_matching(sample, *payload, binary.get());
+            }
+        });
+    }
+}
+
+/**
+ * Kirim micro-batch ke semua loop.
+ * JSON array lengkap dibangun sekali di thread pemanggil; array untuk
+ * client dengan filter dibangun di loop masing-masing.
+ *
+ * @param samples  Data sensor (kunci lookup index)
+ * @param messages JSON setiap data (messages[i] milik samples[i])
+ */
+void UwsServer::publish_batch(absl::Span<const SensorSample> samples,
+                              absl::Span<const std::string> messages) {
+    if (snapshot_on_connect_) {
+        latest_.upsert_batch(samples);
+    }
+
+    const WorkerList& workers = snapshot();
+    if (workers.empty() || samples.empty() || samples.size() != messages.size()) {
+        return;
+    }
+
+    auto batch = std::make_shared<Batch>();
+    batch->samples.assign(samples.begin(), samples.end());
+    batch->messages.assign(messages.begin(), messages.end());
+    batch->full_payload = utils::join_json_array(messages);
+    if (binary_connections_.load(std::memory_order_relaxed) > 0) {
+        batch->full_binary = utils::sensors_to_protobuf_batch(samples);
+        batch->has_binary = true;
+    }
+
+    std::shared_ptr<const Batch> shared = std::move(batch);
+    for (const auto& worker : workers) {
+        worker->loop->defer([worker, shared]() {
+            if (worker->alive) {
+                worker->send_batch(*shared);
+            }
+        });
+    }
+}
+
+std::string UwsServer::backend_name() const {
+    return "uwebsockets";
+}
+
+size_t UwsServer::connection_count() const {
+    return connections_.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,166 @@
+#pragma once
+#include "pipeline/latest_value_table.h"
+#include "utils/snapshot_cell.h"
+#include "websocket/interface_ws_server.h"
+#include "websocket/slow_consumer.h"
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Forward declaration -- header uWebSockets hanya di-include di uws_server.cpp
+namespace uWS {
+struct Loop;
+}
+
+/**
+ * UwsServer -- WebSocket Server menggunakan uWebSockets (backend alternatif)
+ *
+ * Dipilih dengan WS_BACKEND=uws. Dibanding websocketpp:
+ *   - Memori per koneksi jauh lebih kecil (tanpa objek connection + strand)
+ *   - Fan-out memakai pub/sub topic bawaan uWS: publish() membangun frame
+ *     sekali dan menulisnya langsung ke semua subscriber
+ *
+ * Model thread (satu event loop per thread):
+ *   - Setiap thread worker punya uWS::App + uWS::Loop sendiri dan listen di
+ *     port yang SAMA (SO_REUSEPORT), jadi kernel membagi koneksi baru ke
+ *     thread-thread tersebut.
+ *   - Setiap client yang terhubung otomatis subscribe ke topic kTopic.
+ *   - broadcast()/publish() (thread worker bridge) TIDAK menyentuh socket
+ *     secara langsung: pesan di-defer ke setiap loop (Loop::defer
+ *     thread-safe), lalu dikirim di thread loop itu sendiri.
+ *
+ * Format payload (subprotocol, lihat payload_format.h):
+ *   - Dipilih di handler upgrade dari Sec-WebSocket-Protocol.
+ *   - Client JSON di topic kTopic, client protobuf di topic kBinaryTopic;
+ *     payload protobuf hanya dibangun jika ada client protobuf terhubung.
+ *
+ * Langganan per client (pesan subscribe, lihat client_session.h):
+ *   - Client tanpa filter tetap di topic format-nya (jalur pub/sub uWS).
+ *   - Client dengan filter keluar dari topic dan masuk SubscriptionIndex
+ *     milik loop-nya; publish() mengirim langsung ke client yang cocok.
+ *
+ * Slow consumer: batas buffer SlowConsumerConfig dipetakan ke
+ * maxBackpressure uWS (policy disconnect -> closeOnBackpressureLimit).
+ * Untuk client di topic, uWS membuang pesan saat batas terlewati (conflate
+ * tidak didukung pub/sub uWS, jadi diperlakukan seperti drop_newest);
+ * client dengan filter dikirimi langsung dengan policy lengkap.
+ *
+ * Snapshot saat connect: sama seperti WsServer (LatestValueTable), dikirim
+ * di handler open. Karena publish di-defer ke loop yang sama, data yang
+ * masuk setelah snapshot diambil selalu tiba SETELAH frame snapshot.
+ *
+ * Daftar worker disimpan sebagai snapshot copy-on-write (sama seperti
+ * daftar koneksi WsServer), jadi broadcast tidak mengambil mutex.
+ */
+class UwsServer : public IWsServer {
+public:
+    /// Topic pub/sub client JSON (text frame)
+    static constexpr const char* kTopic = "sensors";
+
+    /// Topic pub/sub client protobuf (binary frame)
+    static constexpr const char* kBinaryTopic = "sensors.protobuf";
+
+    /**
+     * @param threads       Jumlah thread event loop (minimal 1)
+     * @param slow_consumer Batas buffer kirim per koneksi + policy
+     * @param snapshot_on_connect true = kirim nilai terakhir semua sensor ke client baru
+     */
+    explicit UwsServer(size_t threads = 1, const SlowConsumerConfig& slow_consumer = {},
+                       bool snapshot_on_connect = true);
+
+    /**
+     * Jalankan server: thread pemanggil + (threads - 1) thread tambahan,
+     * masing-masing dengan event loop sendiri. BLOCKING sampai semua loop
+     * berhenti.
+     * @param port Port number untuk listening
+     */
+    void run(uint16_t port) override;
+
+    /**
+     * Broadcast pesan text ke semua client di semua loop.
+     * Payload disalin SEKALI ke shared_ptr yang dipakai bersama semua loop.
+     * @param message String yang akan dikirim (JSON data sensor)
+     */
+    void broadcast(const std::string& message) override;
+
+    /**
+     * Kirim JSON data sensor ke client yang filter-nya cocok (semua loop).
+     * @param sample  Data sensor (kunci lookup index)
+     * @param message JSON data sensor
+     */
+    void publish(const SensorSample& sample, const std::string& message) override;
+
+    /**
+     * Kirim micro-batch sebagai satu JSON array per client (semua loop).
+     * Client di topic menerima array lengkap lewat App::publish().
+     * @param samples  Data sensor (kunci lookup index)
+     * @param messages JSON setiap data (messages[i] milik samples[i])
+     */
+    void publish_batch(absl::Span<const SensorSample> samples,
+                       absl::Span<const std::string> messages) override;
+
+    /**
+     * Nama backend untuk logging.
+     * @return "uwebsockets"
+     */
+    std::string backend_name() const override;
+
+    /// Jumlah client yang sedang terhubung (semua loop)
+    size_t connection_count() const;
+
+private:
+    /**
+     * Batch yang di-defer ke loop: disalin sekali, dipakai bersama semua loop.
+     */
+    struct Batch {
+        std::vector<SensorSample> samples;
+        std::vector<std::string> messages;
+        std::string full_payload;  // JSON array semua data
+        std::string full_binary;   // SensorBatch semua data (kosong jika tidak ada client protobuf)
+        bool has_binary = false;
+    };
+
+    /**
+     * Satu event loop. send_all/send_matching/send_batch adalah closure ke App dan index
+     * milik loop tersebut, hanya boleh dipanggil dari thread loop (lewat
+     * loop->defer()).
+     */
+    struct Worker {
+        uWS::Loop* loop = nullptr;
+        std::function<void(const std::string&)> send_all;
+        /// (data, JSON, protobuf -- nullptr jika tidak ada client protobuf)
+        std::function<void(const SensorSample&, const std::string&, const std::string*)> send_matching;
+        std::function<void(const Batch&)> send_batch;
+        bool alive = true;  // Diubah/dibaca HANYA di thread loop
+    };
+
+    using WorkerList = std::vector<std::shared_ptr<Worker>>;
+
+    /**
+     * Isi satu thread: buat App, pasang handler, listen, daftarkan Worker,
+     * lalu jalankan loop (BLOCKING).
+     */
+    void run_loop(uint16_t port, size_t index);
+
+    /**
+     * Ambil snapshot daftar worker saat ini (tanpa mutex).
+     * Valid sampai thread ini memanggil snapshot() lagi (utils::SnapshotCell::read()).
+     */
+    const WorkerList& snapshot() const;
+
+    size_t threads_;  // Jumlah thread event loop
+    SlowConsumerConfig slow_consumer_;  // Batas buffer kirim per koneksi + policy
+
+    bool snapshot_on_connect_;  // Kirim nilai terakhir ke client baru
+    LatestValueTable latest_;   // Nilai terakhir per sensor (hanya diisi jika snapshot_on_connect_)
+
+    utils::SnapshotCell<WorkerList> workers_;  // Snapshot worker (reader tanpa mutex)
+    std::mutex writer_mutex_;  // Mutex untuk writer saja (registrasi worker)
+
+    std::atomic<size_t> connections_{0};         // Client aktif (untuk logging)
+    std::atomic<size_t> binary_connections_{0};  // Client protobuf (payload binary hanya dibangun jika > 0)
+};
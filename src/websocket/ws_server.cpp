@@ -10,8 +10,14 @@
  *   - ASIO        : library I/O asynchronous (backend network websocketpp)
  */
 #include "ws_server.h"
+#include "utils/json_helper.h"
 #include <websocketpp/common/connection_hdl.hpp>
+#include <websocketpp/frame.hpp>
+#include <websocketpp/utf8_validator.hpp>
+#include <absl/hash/hash.h>
 #include <functional>
+#include <optional>
+#include <thread>
 #include <spdlog/spdlog.h>
 
 /**
@@ -21,9 +27,20 @@
  *   1. Matikan semua logging internal websocketpp (terlalu verbose)
  *   2. Inisialisasi ASIO (backend network I/O)
  *   3. Aktifkan SO_REUSEADDR agar port bisa langsung dipakai setelah restart
- *   4. Set callback handler untuk event open (connect) dan close (disconnect)
+ *   4. Set callback handler untuk event validate (pilih subprotocol),
+ *      open (connect), close (disconnect), dan message (pesan subscribe dari client)
+ *   5. Terima negosiasi permessage-deflate hanya jika kompresi bersama aktif
+ *   6. Buat satu shard koneksi per thread event loop
+ * 
+ * @param threads       Jumlah thread event loop ASIO (0 dianggap 1)
+ * @param slow_consumer Batas buffer kirim per koneksi + policy
+ * @param compression   Kompresi permessage-deflate bersama
+ * @param snapshot_on_connect true = kirim nilai terakhir semua sensor ke client baru
  */
-WsServer::WsServer() {
+WsServer::WsServer(size_t threads, const SlowConsumerConfig& slow_consumer,
+                   const WsCompressionConfig& compression, bool snapshot_on_connect)
+    : m_threads(threads == 0 ? 1 : threads), m_slow_consumer(slow_consumer),
+      m_snapshot_on_connect(snapshot_on_connect), m_deflate(compression) {
     // Matikan logging internal websocketpp -- kita pakai spdlog sendiri
     m_server.clear_access_channels(websocketpp::log::alevel::all);
     m_server.clear_error_channels(websocketpp::log::elevel::all);
@@ -33,8 +50,20 @@ WsServer::WsServer() {
 
     // Bind callback functions ke event WebSocket
     // std::bind menghubungkan method class ke handler websocketpp
+    m_server.set_validate_handler(std::bind(&WsServer::on_validate, this, std::placeholders::_1));
     m_server.set_open_handler(std::bind(&WsServer::on_open, this, std::placeholders::_1));
     m_server.set_close_handler(std::bind(&WsServer::on_close, this, std::placeholders::_1));
+    m_server.set_message_handler(std::bind(&WsServer::on_message, this,
+                                           std::placeholders::_1, std::placeholders::_2));
+
+    // Tanpa kompresi bersama, tawaran permessage-deflate client ditolak di handshake
+    ws_deflate_config::permessage_deflate_type::accept_offers().store(m_deflate.enabled(),
+                                                                     std::memory_order_relaxed);
+
+    // Strand shard terikat ke io_service, jadi dibuat setelah init_asio()
+    for (size_t i = 0; i < m_threads; ++i) {
+        m_shards.push_back(std::make_unique<Shard>(m_server.get_io_service()));
+    }
 }
 
 /**
@@ -43,7 +72,9 @@ WsServer::WsServer() {
  * Urutan:
  *   1. listen() -- bind ke port dan mulai mendengarkan
  *   2. start_accept() -- mulai menerima koneksi baru
- *   3. run() -- masuk ke event loop (BLOCKING)
+ *      (+ timer flush conflation per shard jika policy CONFLATE)
+ *   3. run() -- masuk ke event loop (BLOCKING) di thread ini
+ *      + (m_threads - 1) thread tambahan pada io_service yang sama
  * 
  * Fungsi ini BLOCKING dan harus dijalankan di thread terpisah.
  * Error handling: jika port sudah dipakai atau error lain, log dan return.
@@ -54,8 +85,33 @@ void WsServer::run(uint16_t port) {
     try {
         m_server.listen(port);         // Bind ke port
         m_server.start_accept();       // Mulai terima koneksi baru
-        spdlog::info("[WebSocket] Listening on port {}", port);
+        spdlog::info("[WebSocket] Listening on port {} ({} thread(s), max_buffered={} bytes, slow_consumer={})",
+                     port, m_threads, m_slow_consumer.max_buffered_bytes,
+                     utils::slow_consumer_policy_name(m_slow_consumer.policy));
+        if (m_slow_consumer.policy == SlowConsumerPolicy::CONFLATE) {
+            for (auto& shard : m_shards) {
+                schedule_conflate_flush(*shard);
+            }
+        }
+        if (m_deflate.enabled()) {
+            spdlog::info("[WebSocket] Shared permessage-deflate enabled (level={}, min_bytes={})",
+                         m_deflate.config().level, m_deflate.config().min_bytes);
+        }
+
+        std::vector<std::thread> pool;
+        for (size_t i = 1; i < m_threads; ++i) {
+            pool.emplace_back([this] {
+                try {
+                    m_server.run();
+                } catch (const std::exception& e) {
+                    spdlog::error("[WebSocket] Event loop thread error: {}", e.what());
+                }
+            });
+        }
         m_server.run();                // Event loop (BLOCKING)
+        for (auto& t : pool) {
+            t.join();
+        }
     } catch (const websocketpp::exception& e) {
         spdlog::error("[WebSocket] Failed to start: {}", e.what());
     } catch (const std::exception& e) {
@@ -63,12 +119,278 @@ void WsServer::run(uint16_t port) {
     }
 }
 
+WsServer::Shard& WsServer::shard_for(const void* connection) {
+    // absl::Hash mengacak bit alamat (std::hash pointer = identitas, dan
+    // alamat heap selalu kelipatan 16 sehingga modulo-nya tidak merata)
+    return *m_shards[absl::Hash<const void*>()(connection) % m_shards.size()];
+}
+
+/**
+ * Antrekan frame yang sudah prepared ke satu koneksi.
+ * connection::send() hanya memasukkan frame ke antrian tulis koneksi;
+ * penulisan socket dijalankan di strand koneksi oleh event loop.
+ * Koneksi protokol lama (Hixie-76, versi < 7) memakai framing berbeda
+ * sehingga dikirim ulang dari payload lewat jalur biasa.
+ */
+void WsServer::send_frame(const server::connection_ptr& con, const server::message_ptr& frame) {
+    if (con->get_version() >= 7) {
+        con->send(frame);  // Buffer yang sama untuk semua client (RFC 6455)
+    } else {
+        con->send(frame->get_payload(), frame->get_opcode());  // Hixie-76: framing sendiri
+    }
+}
+
+websocketpp::frame::opcode::value WsServer::opcode_for(WsPayloadFormat format) {
+    return format == WsPayloadFormat::PROTOBUF ? websocketpp::frame::opcode::binary
+                                               : websocketpp::frame::opcode::text;
+}
+
+/**
+ * Kirim frame ke satu client dengan proteksi slow consumer.
+ * 
+ * Buffer kirim di bawah batas:
+ *   - kirim dulu data yang tertahan conflation (jika ada), kecuali data
+ *     sensor yang sama dengan frame ini (sudah usang)
+ *   - lalu kirim frame ini
+ * 
+ * Buffer kirim melewati batas (policy):
+ *   - DROP_NEWEST : frame ini dibuang
+ *   - CONFLATE    : payload disimpan sebagai data terbaru sensor ini
+ *                   (frame non-sensor dibuang)
+ *   - DISCONNECT  : koneksi ditutup dengan status policy violation
+ * 
+ * @param session Client tujuan
+ * @param frame   Frame yang sudah prepared (deflate untuk client permessage-deflate)
+ * @param sample  Data sensor asal frame, nullptr untuk broadcast biasa
+ */
+void WsServer::deliver(const Session& session, const SharedFrame& frame, const SensorSample* sample) {
+    const server::connection_ptr& con = session.handle;
+    ClientOutbound& outbound = *session.outbound;
+
+    if (con->get_buffered_amount() < m_slow_consumer.max_buffered_bytes) {
+        if (outbound.has_pending.load(std::memory_order_acquire)) {
+            std::optional<int32_t> superseded;
+            if (sample) {
+                superseded = sample->sensor_id;
+            }
+            flush_pending(session, superseded);
+        }
+        send_frame(con, frame.for_session(session));
+        outbound.sent.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    switch (m_slow_consumer.policy) {
+    case SlowConsumerPolicy::DROP_NEWEST:
+        if (outbound.dropped.fetch_add(1, std::memory_order_relaxed) == 0) {
+            spdlog::warn("[WebSocket] Slow client {}: send buffer over {} bytes, dropping frames",
+                         con->get_remote_endpoint(), m_slow_consumer.max_buffered_bytes);
+        }
+        break;
+
+    case SlowConsumerPolicy::CONFLATE:
+        if (sample) {
+            // Payload asli (bukan hasil deflate): dikirim ulang sebagai frame biasa
+            outbound.conflate(sample->sensor_id, std::make_shared<const std::string>(frame.plain->get_payload()));
+        } else {
+            outbound.dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+        break;
+
+    case SlowConsumerPolicy::DISCONNECT: {
+        outbound.dropped.fetch_add(1, std::memory_order_relaxed);
+        if (con->get_state() != websocketpp::session::state::open) {
+            break;  // Sudah dalam proses close
+        }
+        websocketpp::lib::error_code ec;
+        con->close(websocketpp::close::status::policy_violation, "slow consumer", ec);
+        if (!ec) {
+            spdlog::warn("[WebSocket] Slow client {}: send buffer over {} bytes, disconnecting",
+                         con->get_remote_endpoint(), m_slow_consumer.max_buffered_bytes);
+        }
+        break;
+    }
+    }
+}
+
+/**
+ * Kirim data yang tertahan conflation ke satu client. Payload disimpan
+ * tanpa kompresi, jadi dikirim ulang sebagai frame biasa.
+ * 
+ * @param session     Client tujuan
+ * @param skip_sensor Sensor yang data barunya akan segera dikirim
+ */
+void WsServer::flush_pending(const Session& session, std::optional<int32_t> skip_sensor) {
+    const server::connection_ptr& con = session.handle;
+    const auto opcode = opcode_for(session.format);
+    session.outbound->flush_pending(skip_sensor, [&con, opcode](const std::string& payload) {
+        send_frame(con, prepare_frame(payload, opcode));
+    });
+}
+
+/**
+ * Timer flush conflation satu shard.
+ * 
+ * Setiap conflate_flush_interval: client shard ini yang masih punya data
+ * tertahan dan buffer-nya sudah di bawah batas menerima data tersebut.
+ * Handler berjalan di strand shard, jadi tidak paralel dengan fan-out
+ * shard yang sama (multi-thread); pada single-thread, urutan per sensor
+ * dijaga oleh lock antrian ClientOutbound::flush_pending().
+ * 
+ * @param shard Shard yang dijadwalkan
+ */
+void WsServer::schedule_conflate_flush(Shard& shard) {
+    shard.conflate_timer.expires_after(m_slow_consumer.conflate_flush_interval);
+    auto on_tick = [this, &shard](const websocketpp::lib::asio::error_code& ec) {
+        if (ec) {
+            return;  // Timer dibatalkan (io_service berhenti)
+        }
+        shard.index.snapshot()->for_each([this](const Session& session) {
+            if (session.outbound->has_pending.load(std::memory_order_acquire) &&
+                session.handle->get_buffered_amount() < m_slow_consumer.max_buffered_bytes) {
+                flush_pending(session, std::nullopt);
+            }
+        });
+        schedule_conflate_flush(shard);
+    };
+    shard.conflate_timer.async_wait(shard.strand.wrap(on_tick));
+}
+
+/**
+ * Kirim frame micro-batch ke satu client.
+ * 
+ * Buffer di bawah batas, atau policy selain CONFLATE: sama seperti deliver()
+ * (frame array tidak terkait satu sensor, jadi tidak ada data tertahan yang
+ * dianggap usang). CONFLATE dengan buffer penuh: frame array dipecah -- setiap
+ * data disimpan sebagai data terbaru sensornya (dalam format client), jadi
+ * client tetap menerima nilai terakhir setiap sensor saat buffer-nya longgar.
+ * 
+ * @param session  Client tujuan
+ * @param frame    Frame JSON array yang sudah prepared
+ * @param samples  Seluruh data batch
+ * @param messages JSON setiap data batch
+ * @param indices  Posisi data batch yang ada di frame ini
+ */
+void WsServer::deliver_batch(const Session& session, const SharedFrame& frame,
+                             const std::vector<SensorSample>& samples,
+                             const std::vector<std::string>& messages,
+                             absl::Span<const uint32_t> indices) {
+    if (m_slow_consumer.policy != SlowConsumerPolicy::CONFLATE ||
+        session.handle->get_buffered_amount() < m_slow_consumer.max_buffered_bytes) {
+        deliver(session, frame, nullptr);
+        return;
+    }
+
+    ClientOutbound& outbound = *session.outbound;
+    for (uint32_t i : indices) {
+        auto payload = session.format == WsPayloadFormat::PROTOBUF
+                           ? std::make_shared<const std::string>(utils::sensor_to_protobuf(samples[i]))
+                           : std::make_shared<const std::string>(messages[i]);
+        outbound.conflate(samples[i].sensor_id, std::move(payload));
+    }
+}
+
+/**
+ * Jalankan fan-out untuk setiap shard.
+ * 
+ * Single-thread: fan-out langsung di thread pemanggil.
+ * Multi-thread : fan-out tiap shard di-post ke strand shard-nya, sehingga
+ *                shard diproses paralel oleh thread event loop. Snapshot
+ *                index diambil SEKARANG dan ikut di-capture ke task.
+ * 
+ * Iterasi dilakukan di bawah Shard::open_mutex: client yang sedang
+ * dikirimi snapshot tidak menerima data baru sebelum snapshot-nya (lihat
+ * on_open()). Multi-thread: task satu shard sudah serial di strand-nya,
+ * jadi mutex hanya berkontensi dengan on_open.
+ */
+template <typename FanOut>
+void WsServer::for_each_shard(FanOut fan_out) {
+    if (m_shards.size() == 1) {
+        Shard& shard = *m_shards.front();
+        std::lock_guard<std::mutex> lock(shard.open_mutex);
+        fan_out(*shard.index.snapshot());  // Snapshot immutable -- aman tanpa lock index
+        return;
+    }
+
+    for (auto& shard : m_shards) {
+        auto snapshot = shard->index.snapshot();
+        if (snapshot->empty()) {
+            continue;
+        }
+        Shard* target = shard.get();
+        shard->strand.post([target, snapshot, fan_out] {
+            std::lock_guard<std::mutex> lock(target->open_mutex);
+            fan_out(*snapshot);
+        });
+    }
+}
+
+/**
+ * Bangun frame WebSocket sekali untuk dipakai bersama semua koneksi.
+ * 
+ * Sama seperti yang dilakukan processor hybi13 websocketpp untuk setiap
+ * send(), tetapi hanya SEKALI: frame server -> client tidak di-mask,
+ * jadi header + payload identik untuk semua client. Message ditandai
+ * prepared agar connection::send() langsung mengantrekannya.
+ * 
+ * Message tidak terikat ke message manager koneksi mana pun; buffer-nya
+ * dibebaskan otomatis saat koneksi terakhir selesai menulisnya.
+ * 
+ * Frame permessage-deflate (RFC 7692) cukup ditandai bit RSV1 pada frame
+ * pertama (di sini satu-satunya frame) dengan payload hasil deflate.
+ * 
+ * @param payload    Isi pesan
+ * @param opcode     text atau binary
+ * @param compressed true = payload sudah di-deflate (RSV1)
+ * @return Message yang sudah prepared
+ */
+server::message_ptr WsServer::prepare_frame(const std::string& payload,
+                                            websocketpp::frame::opcode::value opcode,
+                                            bool compressed) {
+    auto msg = websocketpp::lib::make_shared<server::message_type>(
+        server::message_type::con_msg_man_ptr(), opcode, payload.size());
+
+    websocketpp::frame::basic_header header(opcode, payload.size(), true /* fin */, false /* mask */,
+                                            compressed /* rsv1 */);
+    websocketpp::frame::extended_header extended(payload.size());
+
+    msg->set_header(websocketpp::frame::prepare_header(header, extended));
+    msg->set_payload(payload);
+    msg->set_prepared(true);
+    return msg;
+}
+
+/**
+ * Bangun frame tanpa kompresi, plus frame deflate jika ada client
+ * permessage-deflate dan kompresi menghemat ukuran. Keduanya dibangun
+ * SEKALI dan dipakai bersama semua client yang bersangkutan.
+ * 
+ * @param payload Isi pesan
+ * @param opcode  text atau binary
+ */
+WsServer::SharedFrame WsServer::build_frame(const std::string& payload,
+                                            websocketpp::frame::opcode::value opcode) const {
+    SharedFrame frame;
+    frame.plain = prepare_frame(payload, opcode);
+    if (m_deflate.enabled() && m_deflate_clients.load(std::memory_order_relaxed) > 0) {
+        std::string compressed;
+        if (m_deflate.compress(payload, compressed)) {
+            frame.deflated = prepare_frame(compressed, opcode, true);
+        }
+    }
+    return frame;
+}
+
 /**
- * Broadcast pesan ke semua client WebSocket yang terhubung.
+ * Broadcast pesan ke semua client WebSocket yang terhubung (tanpa filter).
+ * 
+ * Thread-safe tanpa lock index: iterasi dilakukan pada snapshot index,
+ * sehingga on_close/on_message (thread WebSocket) tidak pernah menunggu
+ * fan-out selesai (on_open menunggu, lihat for_each_shard()). Koneksi yang
+ * ditutup di tengah broadcast cukup menolak send() (state bukan open).
  * 
- * Thread-safe: menggunakan lock_guard untuk melindungi m_connections.
- * Dipanggil dari thread gRPC (via WebSocketAdapter::send()),
- * sementara on_open/on_close dipanggil dari thread WebSocket.
+ * Serialize-once: frame dibangun satu kali (prepare_frame),
+ * lalu message_ptr yang sama diantrekan ke setiap koneksi.
  * 
  * Jika ada error saat mengirim ke satu client, error diabaikan
  * dan broadcast tetap dilanjutkan ke client lain.
@@ -76,34 +398,274 @@ void WsServer::run(uint16_t port) {
  * @param message String yang akan dikirim (JSON data sensor)
  */
 void WsServer::broadcast(const std::string& message) {
-    std::lock_guard<std::mutex> lock(m_mutex);  // Lock selama iterasi
-    for (const auto& hdl : m_connections) {
-        websocketpp::lib::error_code ec;
-        // Kirim sebagai text frame (bukan binary) karena isinya JSON
-        m_server.send(hdl, message, websocketpp::frame::opcode::text, ec);
+    // Text frame wajib UTF-8 valid (processor websocketpp juga menolaknya)
+    if (!websocketpp::utf8_validator::validate(message)) {
+        spdlog::warn("[WebSocket] Broadcast dropped: payload is not valid UTF-8");
+        return;
+    }
+
+    // Kirim sebagai text frame (bukan binary) karena isinya JSON
+    SharedFrame frame = build_frame(message, websocketpp::frame::opcode::text);
+
+    for_each_shard([this, frame](const Index::Snapshot& snapshot) {
+        snapshot.for_each([this, &frame](const Session& session) {
+            deliver(session, frame, nullptr);
+        });
+    });
+}
+
+/**
+ * Kirim JSON data sensor ke client yang filter langganannya cocok.
+ * 
+ * Sama seperti broadcast() (frame dibangun sekali, snapshot index tanpa lock),
+ * tetapi daftar penerima diambil dari SubscriptionIndex: hanya bucket
+ * sensor_id / lokasi data ini + client wildcard yang diperiksa.
+ * Client protobuf menerima frame binary SensorRequest (juga dibangun sekali).
+ * 
+ * @param sample  Data sensor (kunci lookup index)
+ * @param message JSON data sensor
+ */
+void WsServer::publish(const SensorSample& sample, const std::string& message) {
+    if (!websocketpp::utf8_validator::validate(message)) {
+        spdlog::warn("[WebSocket] Publish dropped: payload is not valid UTF-8");
+        return;
+    }
+
+    if (m_snapshot_on_connect) {
+        m_latest.upsert(sample);  // Untuk snapshot client yang connect berikutnya
+    }
+
+    SharedFrame frame = build_frame(message, websocketpp::frame::opcode::text);
+    SharedFrame binary_frame;
+    if (m_binary_clients.load(std::memory_order_relaxed) > 0) {
+        binary_frame = build_frame(utils::sensor_to_protobuf(sample), websocketpp::frame::opcode::binary);
+    }
+
+    for_each_shard([this, frame, binary_frame, sample](const Index::Snapshot& snapshot) {
+        snapshot.for_each_match(sample, [&](const Session& session) {
+            if (session.format == WsPayloadFormat::PROTOBUF) {
+                if (binary_frame.plain) {  // null: client protobuf baru terhubung setelah pengecekan di atas
+                    deliver(session, binary_frame, &sample);
+                }
+                return;
+            }
+            deliver(session, frame, &sample);
+        });
+    });
+}
+
+/**
+ * Kirim micro-batch: satu frame JSON array per client.
+ * 
+ * Frame berisi SEMUA data dibangun sekali dan dipakai bersama oleh client
+ * yang cocok dengan seluruh batch; client dengan filter mendapat frame
+ * sendiri yang hanya berisi data yang cocok (SubscriptionIndex
+ * for_each_batch_match: satu callback per client, bukan per data).
+ * Client protobuf menerima SensorBatch (binary) dengan aturan yang sama.
+ * Batch disalin sekali ke shared_ptr agar aman dipakai task strand.
+ * 
+ * @param samples  Data sensor (kunci lookup index)
+ * @param messages JSON setiap data (messages[i] milik samples[i])
+ */
+void WsServer::publish_batch(absl::Span<const SensorSample> samples,
+                             absl::Span<const std::string> messages) {
+    if (samples.empty() || samples.size() != messages.size()) {
+        return;
+    }
+
+    std::string payload = utils::join_json_array(messages);
+    if (!websocketpp::utf8_validator::validate(payload)) {
+        spdlog::warn("[WebSocket] Batch dropped: payload is not valid UTF-8");
+        return;
+    }
+
+    if (m_snapshot_on_connect) {
+        m_latest.upsert_batch(samples);  // Satu lock untuk seluruh batch
+    }
+
+    SharedFrame full_frame = build_frame(payload, websocketpp::frame::opcode::text);
+    SharedFrame full_binary;
+    if (m_binary_clients.load(std::memory_order_relaxed) > 0) {
+        full_binary = build_frame(utils::sensors_to_protobuf_batch(samples), websocketpp::frame::opcode::binary);
+    }
+    auto batch = std::make_shared<const std::vector<SensorSample>>(samples.begin(), samples.end());
+    auto jsons = std::make_shared<const std::vector<std::string>>(messages.begin(), messages.end());
+
+    for_each_shard([this, full_frame, full_binary, batch, jsons](const Index::Snapshot& snapshot) {
+        snapshot.for_each_batch_match(*batch, [&](const Session& session, absl::Span<const uint32_t> indices) {
+            const bool binary = (session.format == WsPayloadFormat::PROTOBUF);
+            if (binary && !full_binary.plain) {
+                return;  // Client protobuf baru terhubung setelah pengecekan di atas
+            }
+            if (indices.size() == batch->size()) {
+                deliver_batch(session, binary ? full_binary : full_frame, *batch, *jsons, indices);
+                return;
+            }
+            SharedFrame frame =
+                binary ? build_frame(utils::sensors_to_protobuf_batch(*batch, indices),
+                                     websocketpp::frame::opcode::binary)
+                       : build_frame(utils::join_json_array(*jsons, indices),
+                                     websocketpp::frame::opcode::text);
+            deliver_batch(session, frame, *batch, *jsons, indices);
+        });
+    });
+}
+
+std::string WsServer::backend_name() const {
+    return "websocketpp";
+}
+
+/**
+ * Callback saat handshake WebSocket (sebelum on_open).
+ * Jika client menawarkan subprotocol yang dikenali (payload_format.h),
+ * subprotocol itu dipilih dan dikirim balik di response handshake.
+ * Client tanpa subprotocol yang dikenali tetap diterima dengan format JSON.
+ * 
+ * @param hdl Handle koneksi yang sedang handshake
+ * @return true -- koneksi diterima
+ */
+bool WsServer::on_validate(websocketpp::connection_hdl hdl) {
+    websocketpp::lib::error_code ec;
+    server::connection_ptr con = m_server.get_con_from_hdl(hdl, ec);
+    if (ec || !con) {
+        return false;
     }
+
+    std::string selected;
+    if (utils::select_subprotocol(con->get_requested_subprotocols(), selected)) {
+        con->select_subprotocol(selected, ec);
+    }
+    return true;
 }
 
 /**
  * Callback saat client baru terhubung.
  * Dipanggil otomatis oleh websocketpp saat koneksi WebSocket berhasil.
- * Menambahkan handle koneksi ke set agar bisa di-broadcast nanti.
+ * Koneksi didaftarkan ke index shard-nya dengan filter default
+ * (menerima semua data sampai client mengirim pesan subscribe), format
+ * payload sesuai subprotocol yang dipilih di on_validate(), dan tanda
+ * apakah client menerima frame deflate bersama (hasil negosiasi extension).
  * 
  * @param hdl Handle koneksi client baru
  */
 void WsServer::on_open(websocketpp::connection_hdl hdl) {
-    std::lock_guard<std::mutex> lock(m_mutex);  // Thread-safe insert
-    m_connections.insert(hdl);  // Tambah ke daftar koneksi aktif
+    websocketpp::lib::error_code ec;
+    server::connection_ptr con = m_server.get_con_from_hdl(hdl, ec);
+    if (ec || !con) {
+        return;
+    }
+
+    WsPayloadFormat format = utils::payload_format_from_subprotocol(con->get_subprotocol());
+    if (format == WsPayloadFormat::PROTOBUF) {
+        m_binary_clients.fetch_add(1, std::memory_order_relaxed);
+    }
+    bool deflate = m_deflate.enabled() &&
+                   SharedDeflate::accepts_shared_frames(con->get_response_header("Sec-WebSocket-Extensions"));
+    if (deflate) {
+        m_deflate_clients.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    const void* key = con.get();
+    Shard& shard = shard_for(key);
+
+    // Registrasi + snapshot di bawah open_mutex, yang juga dipegang setiap
+    // fan-out shard ini (for_each_shard):
+    //   - fan-out yang belum melihat koneksi ini sudah menulis datanya ke
+    //     LatestValueTable sebelumnya (publish: upsert lalu fan-out), jadi
+    //     datanya ada di snapshot -> tidak terlewat
+    //   - fan-out yang melihat koneksi ini menunggu snapshot terkirim dulu,
+    //     jadi snapshot (nilai lama) tidak pernah tiba setelah nilai baru
+    // Data yang masuk di antaranya paling buruk terkirim dua kali, berurutan.
+    std::lock_guard<std::mutex> lock(shard.open_mutex);
+    shard.index.add(key, con, format, deflate);  // Tambah ke daftar koneksi aktif
+    if (m_snapshot_on_connect) {
+        send_snapshot(con, format, deflate);
+    }
+}
+
+/**
+ * Kirim nilai terakhir semua sensor sebagai SATU frame (format client:
+ * JSON array atau SensorBatch), dikompresi jika client mendukung deflate.
+ * 
+ * @param con     Koneksi client
+ * @param format  Format payload client
+ * @param deflate true jika client menerima frame permessage-deflate
+ */
+void WsServer::send_snapshot(const server::connection_ptr& con, WsPayloadFormat format, bool deflate) {
+    std::vector<SensorSample> latest;
+    m_latest.snapshot(latest);
+    if (latest.empty()) {
+        return;
+    }
+
+    SharedFrame frame = build_frame(utils::samples_payload(latest, format), opcode_for(format));
+    send_frame(con, (deflate && frame.deflated) ? frame.deflated : frame.plain);
+    spdlog::debug("[WebSocket] Sent snapshot of {} sensor(s) to new client", latest.size());
 }
 
 /**
  * Callback saat client terputus.
  * Dipanggil otomatis oleh websocketpp saat koneksi ditutup.
- * Menghapus handle koneksi dari set agar tidak di-broadcast lagi.
+ * Fan-out yang masih memegang snapshot lama tetap aman karena
+ * connection_ptr menjaga objek koneksi tetap hidup. Counter client yang
+ * pernah kehilangan frame (slow consumer) di-log di sini.
  * 
  * @param hdl Handle koneksi client yang terputus
  */
 void WsServer::on_close(websocketpp::connection_hdl hdl) {
-    std::lock_guard<std::mutex> lock(m_mutex);  // Thread-safe erase
-    m_connections.erase(hdl);  // Hapus dari daftar koneksi aktif
+    const void* key = hdl.lock().get();  // Alamat koneksi (sama dengan key di on_open)
+    if (!key) {
+        return;
+    }
+    auto session = shard_for(key).index.remove(key);  // Hapus dari daftar koneksi aktif
+    if (session && session->format == WsPayloadFormat::PROTOBUF) {
+        m_binary_clients.fetch_sub(1, std::memory_order_relaxed);
+    }
+    if (session && session->deflate) {
+        m_deflate_clients.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    if (session && session->outbound->dropped.load(std::memory_order_relaxed) > 0) {
+        const ClientOutbound& outbound = *session->outbound;
+        spdlog::info("[WebSocket] Slow client closed (sent={}, dropped={}, conflated={})",
+                     outbound.sent.load(std::memory_order_relaxed),
+                     outbound.dropped.load(std::memory_order_relaxed),
+                     outbound.conflated.load(std::memory_order_relaxed));
+    }
+}
+
+/**
+ * Callback saat client mengirim pesan.
+ * 
+ * Pesan text di-parse sebagai subscribe/unsubscribe (utils::parse_subscription).
+ * Jika valid, filter koneksi di index diganti dan client menerima ack;
+ * jika tidak, client menerima pesan error dan filter lama tetap berlaku.
+ * Balasan dikirim sebagai frame prepared tanpa kompresi: con->send(string)
+ * akan melewati compressor per koneksi websocketpp (context takeover),
+ * yang tidak sinkron dengan frame SharedDeflate yang diterima client.
+ * 
+ * @param hdl Handle koneksi pengirim
+ * @param msg Pesan dari client
+ */
+void WsServer::on_message(websocketpp::connection_hdl hdl, server::message_ptr msg) {
+    websocketpp::lib::error_code ec;
+    server::connection_ptr con = m_server.get_con_from_hdl(hdl, ec);
+    if (ec || !con || msg->get_opcode() != websocketpp::frame::opcode::text) {
+        return;
+    }
+
+    SubscriptionFilter filter;
+    std::string error;
+    if (!utils::parse_subscription(msg->get_payload(), filter, error)) {
+        send_frame(con, prepare_frame(utils::subscription_error_json(error), websocketpp::frame::opcode::text));
+        return;
+    }
+
+    const void* key = con.get();
+    if (shard_for(key).index.update(key, filter)) {
+        spdlog::debug("[WebSocket] Client subscription updated ({} sensor(s), {} location(s), {} predicate(s))",
+                      filter.sensor_ids.size(), filter.location_ids.size() + filter.location_names.size(),
+                      filter.predicates.size());
+        send_frame(con, prepare_frame(utils::subscription_ack_json(filter), websocketpp::frame::opcode::text));
+    }
 }
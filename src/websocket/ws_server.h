@@ -1,63 +1,353 @@
 #pragma once
+#include "pipeline/latest_value_table.h"
+#include "websocket/interface_ws_server.h"
+#include "websocket/payload_format.h"
+#include "websocket/shared_deflate.h"
+#include "websocket/slow_consumer.h"
+#include "websocket/subscription_index.h"
 #include <websocketpp/config/asio_no_tls.hpp>
+#include <websocketpp/extensions/permessage_deflate/enabled.hpp>
 #include <websocketpp/server.hpp>
-#include <set>
+#include <atomic>
+#include <cstddef>
+#include <memory>
 #include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * permessage-deflate yang hanya dinegosiasikan jika kompresi bersama aktif.
+ * 
+ * websocketpp menegosiasikan extension sebelum validate handler dipanggil,
+ * jadi penolakan harus di sini: jika WS_COMPRESSION bukan "shared",
+ * negotiate() mengembalikan error dan handshake lanjut TANPA extension --
+ * tidak ada z_stream per koneksi dan client tidak mengompresi pesannya.
+ * Flag di-set oleh constructor WsServer (satu WsServer per proses).
+ */
+template <typename config>
+class ws_optional_deflate : public websocketpp::extensions::permessage_deflate::enabled<config> {
+public:
+    typedef websocketpp::extensions::permessage_deflate::enabled<config> base;
+
+    /// true = tawaran permessage-deflate dari client diterima
+    static std::atomic<bool>& accept_offers() {
+        static std::atomic<bool> accept{false};
+        return accept;
+    }
+
+    std::pair<websocketpp::lib::error_code, std::string> negotiate(
+        const websocketpp::http::attribute_list& offer) {
+        if (!accept_offers().load(std::memory_order_relaxed)) {
+            namespace pmd = websocketpp::extensions::permessage_deflate;
+            return std::make_pair(pmd::error::make_error_code(pmd::error::general), std::string());
+        }
+        return base::negotiate(offer);
+    }
+};
+
+/**
+ * Konfigurasi websocketpp: asio tanpa TLS + extension permessage-deflate.
+ * 
+ * Extension menangani negosiasi di handshake dan dekompresi pesan dari
+ * client. Frame keluar TIDAK dikompresi oleh extension (per koneksi):
+ * semua pesan server (data sensor, snapshot, ack/error subscribe) dikirim
+ * sebagai frame prepared, dan hanya dikompresi oleh WsServer sendiri lewat
+ * SharedDeflate: sekali per pesan, dipakai bersama semua client yang
+ * menegosiasikan permessage-deflate. Extension hanya dinegosiasikan jika
+ * WS_COMPRESSION=shared (ws_optional_deflate).
+ */
+struct ws_deflate_config : public websocketpp::config::asio {
+    typedef ws_deflate_config type;
+    typedef websocketpp::config::asio core;
+
+    typedef core::concurrency_type concurrency_type;
+    typedef core::request_type request_type;
+    typedef core::response_type response_type;
+    typedef core::message_type message_type;
+    typedef core::con_msg_manager_type con_msg_manager_type;
+    typedef core::endpoint_msg_manager_type endpoint_msg_manager_type;
+    typedef core::alog_type alog_type;
+    typedef core::elog_type elog_type;
+    typedef core::rng_type rng_type;
+    typedef core::transport_type transport_type;
+    typedef core::endpoint_base endpoint_base;
+
+    struct permessage_deflate_config {};
+    typedef ws_optional_deflate<permessage_deflate_config> permessage_deflate_type;
+};
 
 /**
  * Type alias untuk websocketpp server tanpa TLS (tanpa enkripsi).
  * Menggunakan konfigurasi asio_no_tls karena ini komunikasi internal.
  * Untuk production dengan koneksi dari internet, pertimbangkan asio_tls.
  */
-typedef websocketpp::server<websocketpp::config::asio> server;
+typedef websocketpp::server<ws_deflate_config> server;
 
 /**
- * WsServer -- WebSocket Server menggunakan websocketpp
+ * WsServer -- WebSocket Server menggunakan websocketpp (backend default IWsServer)
  * 
  * Class ini mengelola WebSocket server yang bertugas:
  *   - Menerima koneksi dari client (browser, dashboard, monitoring tool)
- *   - Menyimpan daftar koneksi yang aktif
- *   - Mem-broadcast pesan (JSON data sensor) ke SEMUA client yang terhubung
+ *   - Menyimpan daftar koneksi yang aktif beserta filter langganannya
+ *   - Mengirim JSON data sensor ke client yang berminat (publish), atau
+ *     ke SEMUA client yang terhubung (broadcast)
  * 
  * WebSocket dipilih karena:
  *   - Koneksi persistent (tidak perlu buka-tutup seperti HTTP)
  *   - Server bisa push data ke client (tidak hanya client yang request)
  *   - Cocok untuk streaming data real-time seperti data sensor
  * 
- * Thread safety:
- *   - m_mutex melindungi m_connections dari concurrent access
- *   - broadcast() bisa dipanggil dari thread gRPC
- *   - on_open/on_close dipanggil dari thread WebSocket
+ * Langganan per client:
+ *   - Client mengirim pesan subscribe (JSON, lihat client_session.h) untuk
+ *     memilih sensor_id, lokasi, dan/atau rentang nilai.
+ *   - Koneksi disimpan di SubscriptionIndex (inverted index sensor_id/lokasi
+ *     -> client), sehingga publish() hanya menyentuh client yang cocok.
+ * 
+ * Thread safety (copy-on-write, sama seperti daftar observer di Observable):
+ *   - SubscriptionIndex setiap shard mem-publish snapshot IMMUTABLE
+ *     (utils::SnapshotCell: cache per thread + version atomic)
+ *   - publish()/broadcast() (thread worker bridge, boleh beberapa sekaligus)
+ *     hanya mengambil snapshot lalu iterasi tanpa lock index; multi-thread
+ *     menyalin shared_ptr snapshot ke task strand (satu increment refcount).
+ *     Satu-satunya lock di fan-out adalah Shard::open_mutex (hanya
+ *     berkontensi dengan on_open, lihat snapshot saat connect)
+ *   - on_open/on_close/on_message (thread WebSocket) membangun snapshot baru
+ * 
+ * Slow consumer:
+ *   - Sebelum mengantrekan frame, buffer kirim koneksi dicek terhadap
+ *     SlowConsumerConfig::max_buffered_bytes. Client yang melewati batas
+ *     ditangani sesuai policy (drop_newest / conflate / disconnect), dan
+ *     jumlah frame yang dibuang dicatat per client (ClientOutbound).
+ *   - CONFLATE: data yang tertahan dikirim saat frame berikutnya untuk client
+ *     itu datang, atau oleh timer flush setiap shard (conflate_flush_interval)
+ *     begitu buffer client turun di bawah batas.
+ * 
+ * Multi-thread (WS_THREADS > 1):
+ *   - Event loop ASIO dijalankan oleh N thread pada io_service yang sama.
+ *     Config asio websocketpp memakai strand per koneksi, jadi handler
+ *     satu koneksi tidak pernah berjalan paralel dengan dirinya sendiri.
+ *   - Koneksi dibagi ke N shard (berdasarkan hash pointer koneksi).
+ *     publish()/broadcast() mem-post fan-out setiap shard ke strand shard tersebut,
+ *     sehingga pekerjaan antre-per-koneksi terbagi ke beberapa core,
+ *     sementara urutan pesan per koneksi tetap terjaga.
  * 
  * Alur data:
  *   WebSocketAdapter::send()
- *       -> WsServer::broadcast(json)
- *           -> kirim ke semua connection handle di m_connections
+ *       -> WsServer::publish(sample, json)
+ *           -> prepare_frame(json)  : frame WebSocket dibuat SEKALI
+ *           -> kirim message_ptr yang SAMA ke connection yang cocok (per shard)
+ * 
+ * Format payload per client (payload_format.h):
+ *   - Subprotocol dinegosiasikan di handshake (on_validate); client
+ *     "iot.sensor.protobuf" menerima binary frame protobuf, client lain JSON.
+ *   - Frame protobuf juga dibangun SEKALI per data, dan hanya jika ada
+ *     client protobuf yang terhubung.
+ * 
+ * Kompresi (WS_COMPRESSION=shared):
+ *   - Payload dikompresi SEKALI (SharedDeflate, tanpa context takeover)
+ *     menjadi frame RSV1 yang dipakai bersama semua client permessage-deflate;
+ *     client lain menerima frame tanpa kompresi dari payload yang sama.
+ * 
+ * Snapshot saat connect (WS_SNAPSHOT_ON_CONNECT, default on):
+ *   - publish()/publish_batch() menyimpan nilai terakhir setiap sensor di
+ *     LatestValueTable; client baru langsung menerima SATU frame berisi
+ *     nilai terakhir semua sensor (JSON array / SensorBatch), jadi
+ *     dashboard tidak kosong sampai data berikutnya datang.
+ *   - Registrasi + snapshot dan fan-out shard yang sama saling dikecualikan
+ *     (Shard::open_mutex), jadi snapshot tidak pernah tiba setelah data
+ *     yang lebih baru.
+ * 
+ * Micro-batch (WS_BATCH_MODE=on): WebSocketAdapter memanggil publish_batch(),
+ * satu frame JSON array per client untuk banyak data sekaligus.
  */
-class WsServer {
+class WsServer : public IWsServer {
 public:
     /**
      * Constructor: setup WebSocket server.
      * Konfigurasi: matikan logging internal websocketpp, init ASIO, set handler.
+     * @param threads       Jumlah thread event loop ASIO (minimal 1)
+     * @param slow_consumer Batas buffer kirim per koneksi + policy
+     * @param compression   Kompresi permessage-deflate bersama
+     * @param snapshot_on_connect true = kirim nilai terakhir semua sensor ke client baru
      */
-    WsServer();
+    explicit WsServer(size_t threads = 1, const SlowConsumerConfig& slow_consumer = {},
+                      const WsCompressionConfig& compression = {},
+                      bool snapshot_on_connect = true);
 
     /**
      * Jalankan server di port tertentu.
      * BLOCKING -- fungsi ini tidak return sampai server di-shutdown.
+     * Thread pemanggil ikut menjalankan event loop bersama (threads - 1)
+     * thread tambahan yang di-join sebelum return.
      * Harus dijalankan di thread terpisah (lihat run_ws_server() di app.cpp).
      * @param port Port number untuk listening (default: 9002)
      */
-    void run(uint16_t port);
+    void run(uint16_t port) override;
 
     /**
      * Broadcast pesan ke SEMUA client yang terhubung.
-     * Thread-safe: menggunakan mutex untuk melindungi daftar koneksi.
+     * Payload di-frame SEKALI menjadi message yang sudah "prepared"
+     * (ref-counted), lalu buffer yang sama diantrekan ke setiap koneksi --
+     * tidak ada alokasi atau framing ulang per client.
+     * Thread-safe dan lock-free terhadap on_open/on_close (iterasi snapshot).
      * @param message String yang akan dikirim (biasanya JSON data sensor)
      */
-    void broadcast(const std::string& message);
+    void broadcast(const std::string& message) override;
+
+    /**
+     * Kirim JSON data sensor hanya ke client yang filter-nya cocok.
+     * Frame tetap dibangun SEKALI untuk semua client yang cocok.
+     * @param sample  Data sensor (kunci lookup index)
+     * @param message JSON data sensor
+     */
+    void publish(const SensorSample& sample, const std::string& message) override;
+
+    /**
+     * Kirim micro-batch sebagai satu JSON array per client.
+     * Client yang cocok dengan SEMUA data batch (umumnya client tanpa filter)
+     * berbagi satu frame; client lain menerima array berisi data yang cocok saja.
+     * @param samples  Data sensor (kunci lookup index)
+     * @param messages JSON setiap data (messages[i] milik samples[i])
+     */
+    void publish_batch(absl::Span<const SensorSample> samples,
+                       absl::Span<const std::string> messages) override;
+
+    /**
+     * Nama backend untuk logging.
+     * @return "websocketpp"
+     */
+    std::string backend_name() const override;
 
 private:
+    /// Index langganan. connection_ptr disimpan langsung (bukan
+    /// connection_hdl) agar pengiriman tidak perlu lookup per client.
+    using Index = SubscriptionIndex<server::connection_ptr>;
+    using Session = Index::Session;
+
+    /**
+     * Satu pesan dalam dua bentuk frame prepared: tanpa kompresi dan
+     * permessage-deflate (null jika tidak ada client deflate, payload terlalu
+     * kecil, atau kompresi tidak menghemat).
+     */
+    struct SharedFrame {
+        server::message_ptr plain;
+        server::message_ptr deflated;
+
+        /// Frame yang dikirim ke client ini
+        const server::message_ptr& for_session(const Session& session) const {
+            return (session.deflate && deflated) ? deflated : plain;
+        }
+    };
+
+    /**
+     * Satu shard koneksi: index langganan (copy-on-write) + strand untuk fan-out.
+     * Strand menjamin pesan yang di-post berurutan ke shard ini juga
+     * dieksekusi berurutan (urutan pesan per client terjaga).
+     */
+    struct Shard {
+        explicit Shard(websocketpp::lib::asio::io_service& io) : strand(io), conflate_timer(io) {}
+
+        websocketpp::lib::asio::io_service::strand strand;
+        websocketpp::lib::asio::steady_timer conflate_timer;  // Timer flush conflation (policy CONFLATE)
+        Index index;
+        std::mutex open_mutex;  // Fan-out vs registrasi + snapshot client baru (lihat on_open())
+    };
+
+    /**
+     * Shard tempat sebuah koneksi disimpan (hash pointer koneksi).
+     */
+    Shard& shard_for(const void* connection);
+
+    /**
+     * Kirim frame yang sudah prepared ke satu koneksi (tanpa cek buffer).
+     */
+    static void send_frame(const server::connection_ptr& con, const server::message_ptr& frame);
+
+    /**
+     * Opcode frame data sensor untuk format payload client.
+     */
+    static websocketpp::frame::opcode::value opcode_for(WsPayloadFormat format);
+
+    /**
+     * Kirim frame ke satu client dengan proteksi slow consumer.
+     * @param session Client tujuan
+     * @param frame   Frame yang sudah prepared (bentuk dipilih sesuai client)
+     * @param sample  Data sensor asal frame (kunci conflation), nullptr jika bukan data sensor
+     */
+    void deliver(const Session& session, const SharedFrame& frame, const SensorSample* sample);
+
+    /**
+     * Kirim data yang tertahan conflation ke satu client sebagai frame
+     * prepared sesuai format client.
+     * @param skip_sensor Sensor yang data barunya akan segera dikirim (data lamanya dibuang)
+     */
+    static void flush_pending(const Session& session, std::optional<int32_t> skip_sensor);
+
+    /**
+     * Jadwalkan timer flush conflation shard ini (policy CONFLATE).
+     * Tanpa timer, data tertahan baru terkirim saat frame berikutnya untuk
+     * client itu datang -- yang bisa tidak pernah terjadi untuk sensor
+     * yang berhenti mengirim.
+     */
+    void schedule_conflate_flush(Shard& shard);
+
+    /**
+     * deliver() untuk frame micro-batch. Jika buffer client penuh dan policy
+     * CONFLATE, setiap data di frame disimpan sebagai data terbaru sensornya
+     * (bukan frame array-nya).
+     * @param indices Posisi data batch yang ada di frame ini
+     */
+    void deliver_batch(const Session& session, const SharedFrame& frame,
+                       const std::vector<SensorSample>& samples,
+                       const std::vector<std::string>& messages,
+                       absl::Span<const uint32_t> indices);
+
+    /**
+     * Jalankan fan-out untuk setiap shard: langsung jika single-thread,
+     * atau di-post ke strand shard jika multi-thread.
+     * @param fan_out fn(snapshot index shard) -- dipanggil sekali per shard
+     */
+    template <typename FanOut>
+    void for_each_shard(FanOut fan_out);
+
+    /**
+     * Bangun frame WebSocket (RFC 6455, server -> client, tanpa mask) satu
+     * kali untuk payload ini. Hasilnya bisa dikirim ke banyak koneksi via
+     * connection::send(message_ptr) tanpa diproses ulang.
+     * @param payload    Isi pesan
+     * @param opcode     text atau binary
+     * @param compressed true = payload sudah di-deflate (bit RSV1 di-set)
+     * @return Message yang sudah prepared (header + payload)
+     */
+    static server::message_ptr prepare_frame(const std::string& payload,
+                                             websocketpp::frame::opcode::value opcode,
+                                             bool compressed = false);
+
+    /**
+     * Bangun SharedFrame: frame tanpa kompresi + frame deflate jika ada
+     * client yang menegosiasikan permessage-deflate.
+     */
+    SharedFrame build_frame(const std::string& payload, websocketpp::frame::opcode::value opcode) const;
+
+    /**
+     * Kirim snapshot nilai terakhir semua sensor ke satu client baru
+     * (no-op jika belum ada data).
+     * @param con     Koneksi client
+     * @param format  Format payload client
+     * @param deflate true jika client menerima frame permessage-deflate
+     */
+    void send_snapshot(const server::connection_ptr& con, WsPayloadFormat format, bool deflate);
+
+    /**
+     * Callback: dipanggil saat handshake, sebelum koneksi diterima.
+     * Memilih subprotocol (format payload) dari yang ditawarkan client.
+     * @param hdl Handle koneksi yang sedang handshake
+     * @return true (koneksi selalu diterima; tanpa subprotocol = JSON)
+     */
+    bool on_validate(websocketpp::connection_hdl hdl);
+
     /**
      * Callback: dipanggil saat client baru terhubung.
      * Menambahkan connection handle ke daftar.
@@ -72,14 +362,29 @@ private:
      */
     void on_close(websocketpp::connection_hdl hdl);
 
-    server m_server;  // Instance websocketpp server
-
     /**
-     * Daftar semua koneksi WebSocket yang aktif.
-     * Menggunakan std::set dengan owner_less comparator karena
-     * connection_hdl adalah weak_ptr yang tidak bisa di-compare secara default.
+     * Callback: dipanggil saat client mengirim pesan.
+     * Pesan text diperlakukan sebagai subscribe/unsubscribe; hasilnya
+     * (ack atau error) dibalas ke client tersebut.
+     * @param hdl Handle koneksi pengirim
+     * @param msg Pesan dari client
      */
-    std::set<websocketpp::connection_hdl, std::owner_less<websocketpp::connection_hdl>> m_connections;
+    void on_message(websocketpp::connection_hdl hdl, server::message_ptr msg);
+
+    server m_server;  // Instance websocketpp server
+
+    size_t m_threads;  // Jumlah thread event loop ASIO (= jumlah shard)
+
+    SlowConsumerConfig m_slow_consumer;  // Batas buffer kirim per koneksi + policy
+
+    /// Koneksi aktif, dibagi per shard (1 shard jika single-thread)
+    std::vector<std::unique_ptr<Shard>> m_shards;
+
+    std::atomic<size_t> m_binary_clients{0};  // Client protobuf (frame binary hanya dibangun jika > 0)
+
+    bool m_snapshot_on_connect;  // Kirim nilai terakhir ke client baru
+    LatestValueTable m_latest;   // Nilai terakhir per sensor (hanya diisi jika m_snapshot_on_connect)
 
-    std::mutex m_mutex;  // Mutex untuk thread-safety akses ke m_connections
+    SharedDeflate m_deflate;                   // Kompresi sekali per pesan (WS_COMPRESSION)
+    std::atomic<size_t> m_deflate_clients{0};  // Client permessage-deflate (frame deflate hanya dibangun jika > 0)
 };
@@ -0,0 +1,187 @@
+/**
+ * iot_logdecode.cpp -- Decoder offline untuk journal log biner
+ *
+ * Membaca file iot-journal-*.bin yang ditulis BinaryJournal (LOG_SINK=binary)
+ * dan mencetak record yang sama dengan log teks [DataLogger]:
+ *
+ *   [2026-02-19 10:30:45.123] [info] [DataLogger] sensor_id=1 sensor_name="DHT22" ...
+ *
+ * Cara pakai:
+ *   ./build/iot_logdecode journal/iot-journal-*.bin
+ *
+ * File diproses sesuai urutan argumen (nama file sudah urut waktu).
+ * Format record: lihat src/utils/log_util/journal_format.h
+ */
+#include "utils/log_util/journal_format.h"
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+/// String intern yang didefinisikan di file yang sedang dibaca (id -> teks)
+using StringTable = std::unordered_map<uint32_t, std::string>;
+
+inline void append_value(std::string& out, int32_t value) {
+    out += std::to_string(value);
+}
+
+inline void append_value(std::string& out, int64_t value) {
+    out += std::to_string(value);
+}
+
+inline void append_value(std::string& out, uint32_t value) {
+    out += std::to_string(value);
+}
+
+inline void append_value(std::string& out, uint64_t value) {
+    out += std::to_string(value);
+}
+
+/// Representasi terpendek yang round-trip (sama dengan format {} di log teks)
+inline void append_value(std::string& out, double value) {
+    char buffer[32];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    out.append(buffer, result.ptr);
+}
+
+inline void append_value(std::string& out, float value) {
+    append_value(out, static_cast<double>(value));
+}
+
+inline void append_value(std::string& out, bool value) {
+    out += value ? "true" : "false";
+}
+
+/// Waktu lokal dengan format yang sama seperti pattern spdlog di logger.h
+std::string format_time(int64_t unix_ns) {
+    std::time_t seconds = static_cast<std::time_t>(unix_ns / 1000000000);
+    int millis = static_cast<int>((unix_ns / 1000000) % 1000);
+    std::tm local{};
+    localtime_r(&seconds, &local);
+    char buffer[40];
+    size_t length = std::strftime(buffer, sizeof(buffer), "%Y-%m-%d %H:%M:%S", &local);
+    std::snprintf(buffer + length, sizeof(buffer) - length, ".%03d", millis);
+    return buffer;
+}
+
+std::string render_sensor(const journal::SensorArgs& args, const StringTable& strings) {
+    auto resolve = [&strings](uint32_t id) -> std::string {
+        auto it = strings.find(id);
+        return it != strings.end() ? it->second : std::string();
+    };
+
+    std::string line = "[DataLogger]";
+#define IOT_DECODE_SCALAR(type, name, tag) \
+    line += " " #name "=";                 \
+    append_value(line, args.name);
+#define IOT_DECODE_STRING(name, tag)   \
+    line += " " #name "=\"";           \
+    line += resolve(args.name##_id);   \
+    line += "\"";
+    IOT_SENSOR_REQUEST_FIELDS(IOT_DECODE_SCALAR, IOT_DECODE_STRING)
+#undef IOT_DECODE_SCALAR
+#undef IOT_DECODE_STRING
+    if (args.skipped > 0) {
+        line += " skipped=";
+        append_value(line, args.skipped);
+    }
+    if (args.flags & journal::ANOMALY) {
+        line += " anomaly=1";
+    }
+    return line;
+}
+
+/**
+ * Decode satu file journal ke stdout.
+ * @return false jika file tidak bisa dibaca atau bukan journal yang cocok
+ */
+bool decode_file(const char* path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        std::fprintf(stderr, "iot_logdecode: cannot open %s\n", path);
+        return false;
+    }
+    std::vector<char> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    journal::FileHeader header{};
+    if (data.size() < sizeof(header)) {
+        std::fprintf(stderr, "iot_logdecode: %s is too small\n", path);
+        return false;
+    }
+    std::memcpy(&header, data.data(), sizeof(header));
+    if (std::memcmp(header.magic, journal::kMagic, sizeof(header.magic)) != 0) {
+        std::fprintf(stderr, "iot_logdecode: %s is not a journal file\n", path);
+        return false;
+    }
+    if (header.version != journal::kVersion) {
+        std::fprintf(stderr, "iot_logdecode: %s has unsupported version %u\n", path, header.version);
+        return false;
+    }
+    if (header.sensor_args_size != sizeof(journal::SensorArgs)) {
+        std::fprintf(stderr, "iot_logdecode: %s was written with a different sensor.proto "
+                             "(record size %u, expected %zu)\n",
+                     path, header.sensor_args_size, sizeof(journal::SensorArgs));
+        return false;
+    }
+
+    StringTable strings;
+    size_t offset = sizeof(header);
+    while (offset + sizeof(journal::RecordHeader) <= data.size()) {
+        journal::RecordHeader record{};
+        std::memcpy(&record, data.data() + offset, sizeof(record));
+        if (record.format == journal::END) {
+            break;  // Sisa file yang belum ditulis
+        }
+        const char* payload = data.data() + offset + sizeof(record);
+        offset += sizeof(record) + record.payload_size;
+        if (offset > data.size()) {
+            std::fprintf(stderr, "iot_logdecode: %s: truncated record\n", path);
+            return false;
+        }
+
+        if (record.format == journal::STRING) {
+            journal::StringArgs args{};
+            if (record.payload_size < sizeof(args)) {
+                std::fprintf(stderr, "iot_logdecode: %s: invalid string record\n", path);
+                return false;
+            }
+            std::memcpy(&args, payload, sizeof(args));
+            if (sizeof(args) + args.length > record.payload_size) {
+                std::fprintf(stderr, "iot_logdecode: %s: invalid string record\n", path);
+                return false;
+            }
+            strings[args.id].assign(payload + sizeof(args), args.length);
+        } else if (record.format == journal::SENSOR_DATA) {
+            journal::SensorArgs args{};
+            if (record.payload_size < sizeof(args)) {
+                std::fprintf(stderr, "iot_logdecode: %s: invalid sensor record\n", path);
+                return false;
+            }
+            std::memcpy(&args, payload, sizeof(args));
+            bool anomaly = (args.flags & journal::ANOMALY) != 0;
+            std::printf("[%s] [%s] %s\n", format_time(record.unix_ns).c_str(),
+                        anomaly ? "warning" : "info", render_sensor(args, strings).c_str());
+        }
+        // Format tidak dikenal (journal versi lebih baru): lewati
+    }
+    return true;
+}
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::fprintf(stderr, "Usage: %s <journal.bin> [journal.bin ...]\n", argv[0]);
+        return 1;
+    }
+    bool ok = true;
+    for (int i = 1; i < argc; ++i) {
+        ok = decode_file(argv[i]) && ok;
+    }
+    return ok ? 0 : 1;
+}